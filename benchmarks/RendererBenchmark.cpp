@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int widgetCount = 10000;
+
+    // Calls the function the given amount of times and prints the average time that a call took
+    template <typename Func>
+    void measure(const std::string& name, unsigned int iterations, const Func& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i)
+            func(i);
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << std::left << std::setw(50) << name
+                  << std::right << std::setw(12) << (duration.count() / iterations) << " ns per call" << std::endl;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void printStatistics(const std::string& name, const tgui::RendererStatistics& statistics)
+    {
+        std::cout << name << ":\n"
+                  << "    widgets:           " << statistics.widgetCount << "\n"
+                  << "    renderers:         " << statistics.rendererCount << "\n"
+                  << "    shared bases:      " << statistics.sharedBaseCount << "\n"
+                  << "    properties:        " << statistics.propertyCount << "\n"
+                  << "    observers:         " << statistics.observerCount << "\n"
+                  << "    sharing ratio:     " << statistics.sharingRatio << "\n"
+                  << "    bytes used:        " << statistics.bytesUsed << std::endl;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    const std::string themeFile = (argc > 1) ? argv[1] : TGUI_BENCHMARK_THEME;
+
+    try
+    {
+        tgui::Theme theme{themeFile};
+        theme.getRenderer("Button");
+
+        measure("Theme::getRenderer", 100000, [&](unsigned int){ theme.getRenderer("Button"); });
+
+        std::vector<tgui::Button::Ptr> buttons;
+        buttons.reserve(widgetCount);
+        measure("Button::create with default theme", widgetCount, [&](unsigned int){ buttons.push_back(tgui::Button::create()); });
+
+        buttons.clear();
+        tgui::Theme::setDefault(&theme);
+        measure("Button::create with custom theme", widgetCount, [&](unsigned int){ buttons.push_back(tgui::Button::create()); });
+        tgui::Theme::setDefault(nullptr);
+
+        // All buttons share the renderer of the theme, so every change is passed to all of them
+        tgui::ButtonRenderer sharedRenderer{theme.getRenderer("Button")};
+        measure("setProperty on renderer shared by " + std::to_string(widgetCount) + " widgets", 100,
+                [&](unsigned int i){ sharedRenderer.setTextColor((i % 2) ? sf::Color::Red : sf::Color::Green); });
+
+        const auto defaultRenderer = tgui::Theme::getDefault()->getRenderer("Button");
+        const auto customRenderer = theme.getRenderer("Button");
+        measure("Widget::setRenderer", widgetCount,
+                [&](unsigned int i){ buttons[i]->setRenderer((i % 2) ? defaultRenderer : customRenderer); });
+
+        tgui::Gui gui;
+        for (auto& button : buttons)
+            gui.add(button);
+
+        printStatistics("Renderers of buttons after setRenderer", gui.getRendererStatistics());
+
+        for (auto& button : buttons)
+            button->setRenderer(customRenderer);
+
+        printStatistics("Renderers of buttons with custom theme", gui.getRendererStatistics());
+
+        measure("Overriding a single property of a widget", widgetCount,
+                [&](unsigned int i){ buttons[i]->getRenderer()->setTextColor(sf::Color::Blue); });
+
+        printStatistics("Renderers of buttons overriding a single property", gui.getRendererStatistics());
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -169,6 +169,71 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects the same signal handler to a signal of all widgets inside this container with the given type
+        ///
+        /// @param signalName   Name of the signal
+        /// @param handler      Callback function
+        /// @param args         Optional extra arguments to pass to the signal handler when the signal is emitted
+        ///
+        /// All widgets are searched recursively, so widgets inside child containers are also connected.
+        /// Widgets that are added to the container afterwards aren't connected.
+        /// @code
+        /// grid->connectToDescendants<tgui::Button>("Pressed", [](tgui::Widget::Ptr cell){ ... });
+        /// @endcode
+        ///
+        /// @return Unique ids of the connections
+        ///
+        /// @see connectAll
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T = Widget, typename Func, typename... BoundArgs>
+        std::vector<unsigned int> connectToDescendants(const std::string& signalName, Func&& handler, BoundArgs&&... args)
+        {
+            std::vector<typename T::Ptr> descendants;
+            findDescendants<T>(descendants);
+            return connectAll(descendants, signalName, std::forward<Func>(handler), std::forward<BoundArgs>(args)...);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a handler that is called when a widget inside this container emits a signal with the given name
+        ///
+        /// @param signalName  Name of the signal (e.g. "Pressed" or "ValueChanged")
+        /// @param handler     Callback function that is given the widget that emitted the signal and the name of the signal
+        ///
+        /// The signal bubbles up from the widget to all its parents, so a single handler on a container can serve all widgets
+        /// inside it and inside its child containers, including widgets that are added after connecting the handler.
+        /// The delegated handlers are called after the handlers that are connected to the widget itself. They are always called
+        /// immediately when the signal is emitted, even when the delivery of the signal is queued.
+        /// @code
+        /// panel->connectDelegated("Pressed", [](tgui::Widget::Ptr button, const std::string&){ ... });
+        /// @endcode
+        ///
+        /// @return Unique id of the connection
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectDelegated(const std::string& signalName, const Signal::DelegateEx& handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disconnects a handler that was connected with connectDelegated
+        ///
+        /// @param id  Id of the connection
+        ///
+        /// @return True when a delegated handler with this id existed and was removed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool disconnectDelegated(unsigned int id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disconnects all handlers that were connected with connectDelegated
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectAllDelegated();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -398,10 +463,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +506,23 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds all widgets with the given type inside this container and its child containers to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        void findDescendants(std::vector<typename T::Ptr>& descendants) const
+        {
+            for (const auto& widget : m_widgets)
+            {
+                if (auto descendant = std::dynamic_pointer_cast<T>(widget))
+                    descendants.push_back(std::move(descendant));
+
+                if (const auto* container = dynamic_cast<const Container*>(widget.get()))
+                    container->findDescendants<T>(descendants);
+            }
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -458,6 +540,17 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Handlers for signals that are emitted by widgets inside this container
+        struct DelegatedHandler
+        {
+            unsigned int id;
+            std::string lowercaseSignalName;
+            std::shared_ptr<const Signal::DelegateEx> handler;
+        };
+        std::vector<DelegatedHandler> m_delegatedHandlers;
+
+        friend class Signal; // Signals search the delegated handlers of the parents of the widget that emits them
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <functional>
+#include <atomic>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +45,15 @@ namespace tgui
     {
       public:
 
+        /// @brief Determines when the widgets are updated after the size of the view changed
+        enum class ResizePolicy
+        {
+            Immediate, ///< The layouts are recalculated inside setView
+            Coalesce,  ///< Size changes are combined and the layouts are recalculated once when drawing the next frame
+            Throttle   ///< Like Coalesce, but the layouts are recalculated at most once per throttle interval
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         ///
@@ -85,6 +96,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Gui& operator=(const Gui& right) = delete;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /// Functions that were posted but not yet executed are destroyed without being called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Gui();
+
 #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the window on which the gui should be drawn
@@ -131,6 +150,92 @@ namespace tgui
         const sf::View& getView() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes when the widgets are updated after the size of the view changed
+        ///
+        /// @param policy  Should the layouts be recalculated immediately, once per frame or at a limited rate?
+        ///
+        /// When the window is resized interactively, the view may change many times per frame. With the Coalesce and Throttle
+        /// policies, only the last size is applied to the widgets, from inside the draw function. Until then the widgets keep
+        /// the size of the previous view. By default the policy is Immediate.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizePolicy(ResizePolicy policy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns when the widgets are updated after the size of the view changed
+        ///
+        /// @return Policy that determines when the layouts are recalculated
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ResizePolicy getResizePolicy() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the minimum time between two updates of the widgets when the resize policy is Throttle
+        ///
+        /// @param interval  Minimum time between recalculations of the layouts caused by view changes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizeThrottleInterval(sf::Time interval);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the minimum time between two updates of the widgets when the resize policy is Throttle
+        ///
+        /// @return Minimum time between recalculations of the layouts caused by view changes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getResizeThrottleInterval() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the widgets to the size of the view if this was postponed by the resize policy
+        ///
+        /// This function is called automatically by the draw function. You only need to call it yourself when you need the
+        /// widgets to have their new size before the next frame is drawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyPendingResize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function to be executed on the thread that draws the gui
+        ///
+        /// @param task  Function to execute
+        ///
+        /// This function can safely be called from any thread, it doesn't lock and never waits for the thread that draws the gui.
+        /// The posted functions are executed in the order in which they were posted, at the start of the next draw or handleEvent
+        /// call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function to be executed on the thread that draws the gui, replacing older functions with the same id
+        ///
+        /// @param id    Identifier of the work, only the last function posted with this id before they are executed will be called
+        /// @param task  Function to execute
+        ///
+        /// This can be used to pass e.g. progress updates from a worker thread without executing all of them when the worker
+        /// thread posts faster than the gui is drawn. Like post, this function can be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postCoalesced(std::size_t id, std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the functions that were posted since the last time this function was called
+        ///
+        /// This function is called automatically at the start of the draw and handleEvent functions. Functions that are posted
+        /// while executing the posted functions will only be executed the next time this function is called.
+        ///
+        /// When a posted function throws, the exception is passed on to the caller. The functions that weren't executed yet are
+        /// kept and will be executed the next time this function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void runPostedTasks();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Passes the event to the widgets
         ///
@@ -166,6 +271,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
         ///
+        /// Before drawing, the signal handlers of the queued signals of widgets in this gui are called (see Signal::setDelivery).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw();
 
@@ -396,6 +502,42 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the dependencies between the layouts of all widgets in the gui
+        ///
+        /// @param resetStatistics  Should the evaluation counters of the layouts be reset after retrieving them?
+        ///
+        /// The graph can be used to find layouts that are reevaluated often or that depend on long chains of other layouts.
+        /// The evaluations are only counted while profiling is enabled with Signal::setProfilingEnabled(true). By calling this
+        /// function once per frame with resetStatistics set to true, the evaluation counts of the nodes will contain the
+        /// amount of times the layouts were evaluated during the last frame.
+        ///
+        /// @return Graph containing the layouts that depend on other layouts, together with their dependencies
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        LayoutGraph getLayoutGraph(bool resetStatistics = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how often the signals of the widgets in the gui were emitted and how long their handlers took
+        ///
+        /// @param resetStatistics  Should the statistics of the signals be reset after retrieving them?
+        ///
+        /// Statistics are only collected while profiling is enabled with Signal::setProfilingEnabled(true). By calling this
+        /// function once per frame with resetStatistics set to true, the profile will contain the signals of the last frame.
+        ///
+        /// @return Profile with the statistics of every signal that was emitted, sorted on the time spent in its handlers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalProfile getSignalProfile(bool resetStatistics = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many renderers the widgets in the gui use, how much they are shared and how much memory they take
+        ///
+        /// @return Statistics of the renderers of all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererStatistics getRendererStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -413,6 +555,25 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a function to the list of posted functions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushPostedTask(std::function<void()>&& task, bool coalesced, std::size_t id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Function that was posted to the gui, stored in a singly linked list
+        struct PostedTask
+        {
+            std::function<void()> task;
+            bool coalesced;
+            std::size_t id;
+            PostedTask* next;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -438,8 +599,19 @@ namespace tgui
 
         sf::View m_view;
 
+        ResizePolicy m_resizePolicy = ResizePolicy::Immediate;
+        sf::Time m_resizeThrottleInterval = sf::milliseconds(100);
+        sf::Time m_timeSinceResize; // Time since the widgets were last updated to the size of the view
+        bool m_resizePending = false;
+
         bool m_TabKeyUsageEnabled = true;
 
+        // Functions that were posted since the last time they were executed, with the last posted function at the front
+        std::atomic<PostedTask*> m_postedTasks{nullptr};
+
+        // Functions taken from the posted list that still have to be executed, only accessed by the thread that draws the gui
+        std::queue<std::function<void()>> m_pendingPostedTasks;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
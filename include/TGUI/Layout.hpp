@@ -28,10 +28,13 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <SFML/System/Time.hpp>
 #include <type_traits>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +43,91 @@ namespace tgui
     class Gui;
     class Widget;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Dependencies between the layouts of widgets
+    ///
+    /// The graph can be retrieved with Gui::getLayoutGraph. It contains a node for every layout that depends on another layout
+    /// or on which another layout depends. Layouts that are constants are not part of the graph.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API LayoutGraph
+    {
+        /// The property of the widget that the layout determines
+        enum class Property
+        {
+            Left,
+            Top,
+            Width,
+            Height
+        };
+
+        /// A layout of a widget
+        struct Node
+        {
+            const Widget* widget = nullptr;     ///< Widget that owns the layout
+            std::string widgetName;             ///< Name of the widget in its parent, or its type when it has no name
+            Property property = Property::Left; ///< Property of the widget that the layout determines
+            std::string expression;             ///< String representation of the layout (empty when bind functions were used)
+            float value = 0;                    ///< Current value of the layout
+            unsigned int evaluations = 0;       ///< Amount of times the layout changed the widget while profiling since the statistics were last reset
+            sf::Time lastEvaluationTime;        ///< Time spent on the last change while profiling, including updating the dependent layouts
+            std::size_t depth = 0;              ///< Length of the longest chain of layouts on which this layout depends
+        };
+
+        /// Dependency between two layouts, the value of the dependent layout is calculated from the value of the dependency
+        struct Edge
+        {
+            std::size_t dependency = 0;         ///< Index of the node on which the other node depends
+            std::size_t dependent = 0;          ///< Index of the node that depends on the other node
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the graph for a widget and all widgets inside it
+        ///
+        /// @param root  Widget for which the graph is created (e.g. the container of the gui)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit LayoutGraph(const Widget& root);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the length of the longest chain of dependencies in the graph
+        ///
+        /// @return Highest depth of all nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDepth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the graph to the DOT language so that it can be visualized with Graphviz
+        ///
+        /// @return Description of the graph in the DOT language
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string toDot() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a description of a widget that can be used to identify it in messages
+        ///
+        /// @return Name of the widget in its parent, or its type when it has no name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getWidgetDescription(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the name of a property ("left", "top", "width" or "height")
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getPropertyName(Property property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        std::vector<Node> nodes;
+        std::vector<Edge> edges;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Class to store the left, top, width or height of a widget
     ///
@@ -173,6 +261,9 @@ namespace tgui
         ///        and sets a callback function so that the widget can be alerted when the value of the widget changes.
         ///
         /// The xAxis parameter tells the layout whether it contains the left/width or top/height value.
+        ///
+        /// @throw Exception when the layout belongs to the widget and would depend on itself. The layout is changed into
+        ///                  a constant with the value it had before the binding was made in this case.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler);
 
@@ -180,57 +271,118 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  Widget that is being destroyed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout based on the operation it contains and the values of the bound widgets
+        ///        and inform the connected widget when the value of the layout has changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the properties of the widgets on which this layout directly depends to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getDependencies(std::vector<std::pair<const Widget*, LayoutGraph::Property>>& dependencies) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Immutable description of the expression, shared by all copies of the layout. Defined in Layout.cpp.
+        struct Expression;
+
+        // A widget property on which the layout depends. Unlike the expression, the bindings are unique to each copy of the layout.
+        struct Binding
+        {
+            Operation operation = Operation::BindingString; // Property of the bound widget, or BindingString when not resolved yet
+            Widget* widget = nullptr; // The widget on which this layout depends, or a nullptr when not bound
+            float value = 0; // The last known value of the bound property
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the layout into a single binding that refers to a widget by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void initBindingString(std::string boundString);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the expression of the operand into the new expression, adding its bindings to this layout.
+        // Returns the index of the node that contains the result of the operand.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t appendOperand(Expression& expression, const Layout& operand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Disconnects bindings that were created from a string, the same name may apply to a different widget in the copy
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetStringBindings();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // If widgets are bound, inform them that the layout no longer binds them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Check whether the expression contains strings that refer to widgets which should be bound.
+        // Returns whether a binding was added or changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool parseBindingStrings(Widget* widget, bool xAxis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Find the widget and property corresponding to the given name. Returns false if the string couldn't be resolved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Operation& boundOperation, Widget*& boundWidget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the cached value of a binding based on the current state of the bound widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateBindingValue(Binding& binding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value of a node in the expression
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        float evaluate(std::size_t nodeIndex) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Converts a node in the expression to a string
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        std::string nodeToString(std::size_t nodeIndex) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Searches the layouts on which this layout depends, directly or indirectly, for the given layout.
+        // When it is found, the path contains the widget properties that lead from this layout to the given layout.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        bool findDependency(const Layout* layout, std::set<const Layout*>& visitedLayouts,
+                            std::vector<std::pair<const Widget*, LayoutGraph::Property>>& path) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
+        std::shared_ptr<const Expression> m_expression = nullptr; // The operations and constants of the layout, or a nullptr when the layout is a constant
+        std::vector<Binding> m_bindings; // State of each binding in the expression, indexed by the binding index of the nodes
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
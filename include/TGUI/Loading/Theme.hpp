@@ -57,17 +57,101 @@ namespace tgui
         ~Theme();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// When hot reload is enabled in the other theme, the new theme will watch the theme file on its own.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Theme(const Theme& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Theme(Theme&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Theme& operator=(const Theme& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Theme& operator=(Theme&& other);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the primary theme loader parameter
         ///
         /// @param primary  Primary parameter for the theme loader (filename of the theme file in DefaultThemeLoader)
         ///
         /// When the theme was loaded before and a renderer with the same name is encountered, the widgets that were using
-        /// the old renderer will be reloaded with the new renderer.
+        /// the old renderer will be reloaded with the new renderer. Only the properties that got a different value are
+        /// passed to these widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading the images of a theme on worker threads, so that switching to the theme doesn't block
+        ///
+        /// @param primary  Primary parameter for the theme loader (filename of the theme file in DefaultThemeLoader)
+        ///
+        /// The theme itself is not changed yet. The images are loaded for the renderers that are already in use, once the
+        /// returned future is ready you can call load with the same parameter to apply the theme without having to wait
+        /// for the images to be decoded. Calling load earlier is allowed, it then waits for the images that are still loading.
+        /// Images that aren't used by any texture once load has updated the renderers are released again.
+        /// @code
+        /// auto themeLoaded = theme.loadAsync("themes/Black.txt");
+        /// ...
+        /// if (themeLoaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        ///     theme.load("themes/Black.txt");
+        /// @endcode
+        ///
+        /// @return Future that becomes ready when all images have been loaded or failed to load
+        ///
+        /// @exception Exception when the theme loader fails to load the theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<void> loadAsync(const std::string& primary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Watches the theme file for changes, so that the theme can be reloaded while the program is running
+        ///
+        /// @param enabled  Should reloadIfChanged reload the theme when the theme file is modified?
+        ///
+        /// This is meant for designing a theme without having to restart the program after each change. The file is watched
+        /// with inotify on Linux, on other platforms the modification time of the file is checked in every reloadIfChanged call.
+        /// Hot reload is only supported for theme files that are loaded by the DefaultThemeLoader or BinaryThemeLoader.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHotReloadEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the theme file is being watched for changes
+        ///
+        /// @return Is hot reload enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isHotReloadEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reloads the theme if the theme file was modified since the last time it was loaded
+        ///
+        /// Call this function regularly (e.g. once per frame) after enabling hot reload with setHotReloadEnabled.
+        /// Only the modified theme file is parsed again and only the widgets for which a renderer property got a different
+        /// value are informed about the change.
+        ///
+        /// @return True when the theme file was modified and the theme was reloaded
+        ///
+        /// @exception Exception when the modified theme file can't be loaded, the renderers remain unchanged in that case
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reloadIfChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -162,10 +246,15 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        class FileWatcher; // Detects modifications to the theme file when hot reload is enabled
+
         static Theme* m_defaultTheme;
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        bool m_hotReloadEnabled = false;
+        std::unique_ptr<FileWatcher> m_fileWatcher;
+        std::vector<sf::String> m_asyncTextureIds; // Images loaded by loadAsync, released by load when no texture uses them
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
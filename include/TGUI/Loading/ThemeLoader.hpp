@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -85,6 +86,20 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as values that can be stored in a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation stores the strings returned by the load function. Loaders that already parsed nested
+        /// sections can return them as renderers, so that they don't have to be parsed again when the renderer is used.
+        ///
+        /// @return Map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::map<std::string, ObjectConverter> loadProperties(const std::string& primary, const std::string& secondary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -136,6 +151,23 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as values that can be stored in a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Nested sections and references to other sections are returned as renderers that were created directly from the
+        /// parsed file, instead of as text that has to be parsed again.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadProperties(const std::string& filename, const std::string& section) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -159,13 +191,112 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    private:
+    protected:
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> m_renderersCache;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
     };
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Theme loader for theme files that were compiled to a binary format
+    ///
+    /// Loading a text theme requires tokenizing and parsing the file, turning filenames into paths relative to the theme
+    /// and resolving references between sections. The compile function does all this work once and stores the result in a
+    /// binary file, so that loading the theme later only has to locate the strings and the sections in it. The strings of a
+    /// section are only decoded when the section is loaded, nested sections and references are stored as section indices.
+    /// @code
+    /// tgui::BinaryThemeLoader::compile("themes/Black.txt", "themes/Black.bin"); // E.g. done while building the application
+    ///
+    /// tgui::Theme::setThemeLoader(std::make_shared<tgui::BinaryThemeLoader>());
+    /// tgui::Theme theme{"themes/Black.bin"};
+    /// @endcode
+    ///
+    /// Texture and font filenames are stored in the same way as the text theme would have resolved them, so the resources
+    /// have to stay at the location where they were found relative to the text theme when it was compiled.
+    /// Files that don't start with the binary header are still loaded as text themes.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BinaryThemeLoader : public DefaultThemeLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the binary theme file in cache
+        ///
+        /// @param filename  Filename of the binary theme file to load
+        ///
+        /// @exception Exception when the file could not be opened or when it is corrupt
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const std::string& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when the file could not be opened or when it is corrupt
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Check if the requested property-value pairs are available
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Whether a map op property-value pairs is available
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoad(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as values that can be stored in a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The renderer is created directly from the binary section, nested sections and references become renderers as well.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when the file could not be opened or when it is corrupt
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadProperties(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a text theme file to the binary format
+        ///
+        /// @param filename        Filename of the text theme file
+        /// @param binaryFilename  Filename of the binary file to create
+        ///
+        /// @exception Exception when the text theme could not be loaded or when the binary file could not be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compile(const std::string& filename, const std::string& binaryFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the renderer of a section from a preloaded binary theme to the renderer cache, if not already there
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createSectionRenderer(const std::string& filename, const std::string& section);
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -103,12 +103,13 @@ namespace tgui
         /// @brief Stores a string for later retrieval
         ///
         /// @param string  String to store
+        ///
+        /// When the string is later retrieved as a different type (e.g. with getColor), it is only deserialized once.
+        /// Copies of this object share the deserialized value, so renderers cloned from a theme don't parse it again.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const sf::String& string) :
             m_type      {Type::String},
-            m_value     {string},
-            m_serialized{true},
-            m_string    {string}
+            m_serialized{std::make_shared<Serialized>(string)}
         {
         }
 
@@ -317,6 +318,17 @@ namespace tgui
         Texture& getTexture();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the saved texture without converting the object
+        ///
+        /// @return The saved texture
+        ///
+        /// This function will assert when something other than a texture was saved, including a string that could be converted
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Texture& getTexture() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the saved text style
         ///
@@ -366,16 +378,37 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        Type m_type = Type::None;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the stored string by the value deserialized from it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deserializeAs(Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
 
     #ifdef TGUI_USE_CPP17
-        std::variant<sf::String, Font, Color, Outline, bool, float, Texture, TextStyle, std::shared_ptr<RendererData>> m_value;
+        using Value = std::variant<Font, Color, Outline, bool, float, Texture, TextStyle, std::shared_ptr<RendererData>>;
     #else
-        Any  m_value;
+        using Value = Any;
     #endif
 
-        bool m_serialized = false;
-        sf::String m_string;
+        // String representation of the value, shared between all copies of the object converter.
+        // The value that was deserialized from the string is cached next to it. Converting one copy fills this cache for all
+        // copies, so copies of the same string should not be converted from different threads at the same time.
+        struct Serialized
+        {
+            Serialized(const sf::String& str) : string{str} {}
+
+            sf::String string;
+            Type valueType = Type::None;
+            Value value;
+        };
+
+        Type m_type = Type::None;
+        Value m_value;
+        std::shared_ptr<Serialized> m_serialized;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
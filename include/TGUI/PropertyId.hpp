@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROPERTY_ID_HPP
+#define TGUI_PROPERTY_ID_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Properties of the renderers that are part of TGUI, these properties have an id that is already known at compile time.
+// Every entry contains the name of the id, the name of the property and the ObjectConverter type of its value. The names of
+// the id and the property only differ when the property has the same name as a type in the tgui namespace.
+#define TGUI_PROPERTY_IDS(PROPERTY) \
+    PROPERTY(ArrowBackgroundColor, ArrowBackgroundColor, Color) \
+    PROPERTY(ArrowBackgroundColorHover, ArrowBackgroundColorHover, Color) \
+    PROPERTY(ArrowColor, ArrowColor, Color) \
+    PROPERTY(ArrowColorHover, ArrowColorHover, Color) \
+    PROPERTY(BackgroundColor, BackgroundColor, Color) \
+    PROPERTY(BackgroundColorChecked, BackgroundColorChecked, Color) \
+    PROPERTY(BackgroundColorCheckedDisabled, BackgroundColorCheckedDisabled, Color) \
+    PROPERTY(BackgroundColorCheckedHover, BackgroundColorCheckedHover, Color) \
+    PROPERTY(BackgroundColorDisabled, BackgroundColorDisabled, Color) \
+    PROPERTY(BackgroundColorDown, BackgroundColorDown, Color) \
+    PROPERTY(BackgroundColorFocused, BackgroundColorFocused, Color) \
+    PROPERTY(BackgroundColorHover, BackgroundColorHover, Color) \
+    PROPERTY(BorderBelowTitleBar, BorderBelowTitleBar, Number) \
+    PROPERTY(BorderBetweenArrows, BorderBetweenArrows, Number) \
+    PROPERTY(BorderColor, BorderColor, Color) \
+    PROPERTY(BorderColorChecked, BorderColorChecked, Color) \
+    PROPERTY(BorderColorCheckedDisabled, BorderColorCheckedDisabled, Color) \
+    PROPERTY(BorderColorCheckedFocused, BorderColorCheckedFocused, Color) \
+    PROPERTY(BorderColorCheckedHover, BorderColorCheckedHover, Color) \
+    PROPERTY(BorderColorDisabled, BorderColorDisabled, Color) \
+    PROPERTY(BorderColorDown, BorderColorDown, Color) \
+    PROPERTY(BorderColorFocused, BorderColorFocused, Color) \
+    PROPERTY(BorderColorHover, BorderColorHover, Color) \
+    PROPERTY(BordersProperty, Borders, Outline) \
+    PROPERTY(ButtonProperty, Button, RendererData) \
+    PROPERTY(CaretColor, CaretColor, Color) \
+    PROPERTY(CaretColorFocused, CaretColorFocused, Color) \
+    PROPERTY(CaretColorHover, CaretColorHover, Color) \
+    PROPERTY(CaretWidth, CaretWidth, Number) \
+    PROPERTY(CheckColor, CheckColor, Color) \
+    PROPERTY(CheckColorDisabled, CheckColorDisabled, Color) \
+    PROPERTY(CheckColorHover, CheckColorHover, Color) \
+    PROPERTY(CloseButton, CloseButton, RendererData) \
+    PROPERTY(DefaultTextColor, DefaultTextColor, Color) \
+    PROPERTY(DefaultTextStyle, DefaultTextStyle, TextStyle) \
+    PROPERTY(DistanceToSide, DistanceToSide, Number) \
+    PROPERTY(FillColor, FillColor, Color) \
+    PROPERTY(FontProperty, Font, Font) \
+    PROPERTY(ImageRotation, ImageRotation, Number) \
+    PROPERTY(ListBoxProperty, ListBox, RendererData) \
+    PROPERTY(MaximizeButton, MaximizeButton, RendererData) \
+    PROPERTY(MinimizeButton, MinimizeButton, RendererData) \
+    PROPERTY(MinimumResizableBorderWidth, MinimumResizableBorderWidth, Number) \
+    PROPERTY(Opacity, Opacity, Number) \
+    PROPERTY(PaddingProperty, Padding, Outline) \
+    PROPERTY(PaddingBetweenButtons, PaddingBetweenButtons, Number) \
+    PROPERTY(ScrollbarProperty, Scrollbar, RendererData) \
+    PROPERTY(ScrollbarWidth, ScrollbarWidth, Number) \
+    PROPERTY(SelectedBackgroundColor, SelectedBackgroundColor, Color) \
+    PROPERTY(SelectedBackgroundColorHover, SelectedBackgroundColorHover, Color) \
+    PROPERTY(SelectedTextBackgroundColor, SelectedTextBackgroundColor, Color) \
+    PROPERTY(SelectedTextColor, SelectedTextColor, Color) \
+    PROPERTY(SelectedTextColorHover, SelectedTextColorHover, Color) \
+    PROPERTY(SelectedTextStyle, SelectedTextStyle, TextStyle) \
+    PROPERTY(SelectedTrackColor, SelectedTrackColor, Color) \
+    PROPERTY(SelectedTrackColorHover, SelectedTrackColorHover, Color) \
+    PROPERTY(ShowTextOnTitleButtons, ShowTextOnTitleButtons, Bool) \
+    PROPERTY(SpaceBetweenWidgets, SpaceBetweenWidgets, Number) \
+    PROPERTY(TextColor, TextColor, Color) \
+    PROPERTY(TextColorChecked, TextColorChecked, Color) \
+    PROPERTY(TextColorCheckedDisabled, TextColorCheckedDisabled, Color) \
+    PROPERTY(TextColorCheckedHover, TextColorCheckedHover, Color) \
+    PROPERTY(TextColorDisabled, TextColorDisabled, Color) \
+    PROPERTY(TextColorDown, TextColorDown, Color) \
+    PROPERTY(TextColorFilled, TextColorFilled, Color) \
+    PROPERTY(TextColorFocused, TextColorFocused, Color) \
+    PROPERTY(TextColorHover, TextColorHover, Color) \
+    PROPERTY(TextDistanceRatio, TextDistanceRatio, Number) \
+    PROPERTY(TextStyleProperty, TextStyle, TextStyle) \
+    PROPERTY(TextStyleChecked, TextStyleChecked, TextStyle) \
+    PROPERTY(TextStyleDisabled, TextStyleDisabled, TextStyle) \
+    PROPERTY(TextStyleDown, TextStyleDown, TextStyle) \
+    PROPERTY(TextStyleFocused, TextStyleFocused, TextStyle) \
+    PROPERTY(TextStyleHover, TextStyleHover, TextStyle) \
+    PROPERTY(TextureProperty, Texture, Texture) \
+    PROPERTY(TextureArrow, TextureArrow, Texture) \
+    PROPERTY(TextureArrowDown, TextureArrowDown, Texture) \
+    PROPERTY(TextureArrowDownHover, TextureArrowDownHover, Texture) \
+    PROPERTY(TextureArrowHover, TextureArrowHover, Texture) \
+    PROPERTY(TextureArrowUp, TextureArrowUp, Texture) \
+    PROPERTY(TextureArrowUpHover, TextureArrowUpHover, Texture) \
+    PROPERTY(TextureBackground, TextureBackground, Texture) \
+    PROPERTY(TextureBranchCollapsed, TextureBranchCollapsed, Texture) \
+    PROPERTY(TextureBranchExpanded, TextureBranchExpanded, Texture) \
+    PROPERTY(TextureChecked, TextureChecked, Texture) \
+    PROPERTY(TextureCheckedDisabled, TextureCheckedDisabled, Texture) \
+    PROPERTY(TextureCheckedFocused, TextureCheckedFocused, Texture) \
+    PROPERTY(TextureCheckedHover, TextureCheckedHover, Texture) \
+    PROPERTY(TextureDisabled, TextureDisabled, Texture) \
+    PROPERTY(TextureDisabledTab, TextureDisabledTab, Texture) \
+    PROPERTY(TextureDown, TextureDown, Texture) \
+    PROPERTY(TextureFill, TextureFill, Texture) \
+    PROPERTY(TextureFocused, TextureFocused, Texture) \
+    PROPERTY(TextureForeground, TextureForeground, Texture) \
+    PROPERTY(TextureHover, TextureHover, Texture) \
+    PROPERTY(TextureItemBackground, TextureItemBackground, Texture) \
+    PROPERTY(TextureLeaf, TextureLeaf, Texture) \
+    PROPERTY(TextureSelectedItemBackground, TextureSelectedItemBackground, Texture) \
+    PROPERTY(TextureSelectedTab, TextureSelectedTab, Texture) \
+    PROPERTY(TextureSelectedTabHover, TextureSelectedTabHover, Texture) \
+    PROPERTY(TextureTab, TextureTab, Texture) \
+    PROPERTY(TextureTabHover, TextureTabHover, Texture) \
+    PROPERTY(TextureThumb, TextureThumb, Texture) \
+    PROPERTY(TextureThumbHover, TextureThumbHover, Texture) \
+    PROPERTY(TextureTitleBar, TextureTitleBar, Texture) \
+    PROPERTY(TextureTrack, TextureTrack, Texture) \
+    PROPERTY(TextureTrackHover, TextureTrackHover, Texture) \
+    PROPERTY(TextureUnchecked, TextureUnchecked, Texture) \
+    PROPERTY(TextureUncheckedDisabled, TextureUncheckedDisabled, Texture) \
+    PROPERTY(TextureUncheckedFocused, TextureUncheckedFocused, Texture) \
+    PROPERTY(TextureUncheckedHover, TextureUncheckedHover, Texture) \
+    PROPERTY(ThumbColor, ThumbColor, Color) \
+    PROPERTY(ThumbColorHover, ThumbColorHover, Color) \
+    PROPERTY(TitleBarColor, TitleBarColor, Color) \
+    PROPERTY(TitleBarHeight, TitleBarHeight, Number) \
+    PROPERTY(TitleColor, TitleColor, Color) \
+    PROPERTY(TrackColor, TrackColor, Color) \
+    PROPERTY(TrackColorHover, TrackColorHover, Color) \
+    PROPERTY(TransparentTexture, TransparentTexture, Bool)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Integer that identifies a renderer property
+    ///
+    /// Renderers store their properties and inform widgets about changes based on this id instead of on the name of the
+    /// property. The names are only needed when properties are set by name or when a renderer is saved or loaded.
+    ///
+    /// The properties used by the renderers of TGUI have a fixed id (e.g. PropertyId::BackgroundColor). When the name of the
+    /// property is also the name of a type, the id has a Property suffix (e.g. PropertyId::PaddingProperty).
+    /// Every other property gets an id the first time getPropertyId is called with its name.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class PropertyId : unsigned int
+    {
+    #define TGUI_PROPERTY_ID_ENUM_VALUE(ID, NAME, TYPE) ID,
+        TGUI_PROPERTY_IDS(TGUI_PROPERTY_ID_ENUM_VALUE)
+    #undef TGUI_PROPERTY_ID_ENUM_VALUE
+
+        BuiltinCount ///< Amount of properties with a fixed id, the ids of other properties are larger
+    };
+
+
+    namespace priv
+    {
+        // Ids of the built-in properties based on the name of the property (e.g. BordersPropertyId), for use in macros
+    #define TGUI_PROPERTY_ID_CONSTANT(ID, NAME, TYPE) constexpr PropertyId NAME##PropertyId = PropertyId::ID;
+        TGUI_PROPERTY_IDS(TGUI_PROPERTY_ID_CONSTANT)
+    #undef TGUI_PROPERTY_ID_CONSTANT
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a property
+    ///
+    /// @param lowercaseProperty  Name of the property in lowercase
+    ///
+    /// @return Id of the property. A new id is created when no property with this name was seen before.
+    ///
+    /// This function is thread-safe.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API PropertyId getPropertyId(const std::string& lowercaseProperty);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Looks up the id of a property without creating a new id for an unknown name
+    ///
+    /// @param lowercaseProperty  Name of the property in lowercase
+    /// @param property           Set to the id of the property when it was found
+    ///
+    /// @return True when the property already had an id, false when getPropertyId was never called with this name
+    ///
+    /// This function is thread-safe.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool tryGetPropertyId(const std::string& lowercaseProperty, PropertyId& property);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the name of a property
+    ///
+    /// @param property  Id of the property, as returned by getPropertyId
+    ///
+    /// @return Lowercase name of the property
+    ///
+    /// This function is thread-safe.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API const std::string& getPropertyName(PropertyId property);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_ID_HPP
@@ -34,15 +34,16 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
     void CLASS::set##NAME(const Outline& outline) \
     { \
-        setProperty(toLower(#NAME), {outline}); \
+        setProperty(priv::NAME##PropertyId, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,15 +51,16 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(Color color) \
     { \
-        setProperty(toLower(#NAME), {color}); \
+        setProperty(priv::NAME##PropertyId, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,15 +68,16 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(TextStyle style) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{style}); \
+        setProperty(priv::NAME##PropertyId, ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +85,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -93,7 +97,7 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{number}); \
+        setProperty(priv::NAME##PropertyId, ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,9 +105,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -112,26 +117,30 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{flag}); \
+        setProperty(priv::NAME##PropertyId, ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
-    Texture& CLASS::get##NAME() const \
+    const Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(priv::NAME##PropertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
-        else \
-        { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
-        } \
+        \
+        /* A texture in the shared base is returned without copying it, only a texture that still has to be loaded is stored here */ \
+        const ObjectConverter* value = m_data->findProperty(priv::NAME##PropertyId); \
+        if (value && (value->getType() == ObjectConverter::Type::Texture)) \
+            return value->getTexture(); \
+        \
+        ObjectConverter& storedValue = m_data->propertyValuePairs[priv::NAME##PropertyId]; \
+        storedValue = value ? *value : ObjectConverter{Texture{}}; \
+        return storedValue.getTexture(); \
     } \
     void CLASS::set##NAME(const Texture& texture) \
     { \
-        setProperty(toLower(#NAME), {texture}); \
+        setProperty(priv::NAME##PropertyId, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,19 +148,20 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        ObjectConverter temporary; \
+        ObjectConverter* value = m_data->findConvertibleProperty(priv::NAME##PropertyId, temporary); \
+        if (value) \
+            return value->getRenderer(); \
         else \
         { \
             auto renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            m_data->propertyValuePairs[priv::NAME##PropertyId] = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<RendererData> renderer) \
     { \
-        setProperty(toLower(#NAME), {renderer}); \
+        setProperty(priv::NAME##PropertyId, {renderer}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,7 +343,7 @@ namespace tgui
         /// @return texture of the button
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTexture() const;
+        const Texture& getTexture() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,7 +361,7 @@ namespace tgui
         /// @return hover texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureHover() const;
+        const Texture& getTextureHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,7 +379,7 @@ namespace tgui
         /// @return down texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureDown() const;
+        const Texture& getTextureDown() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -397,7 +397,7 @@ namespace tgui
         /// @return disabled texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureDisabled() const;
+        const Texture& getTextureDisabled() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,7 +411,7 @@ namespace tgui
         /// @brief Returns the image that is drawn on top of the button image when the button is focused
         /// @return focused texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureFocused() const;
+        const Texture& getTextureFocused() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,7 +129,7 @@ namespace tgui
         /// @return Background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureBackground() const;
+        const Texture& getTextureBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,7 +251,7 @@ namespace tgui
         /// @return title bar texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTitleBar() const;
+        const Texture& getTextureTitleBar() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,7 +241,7 @@ namespace tgui
         /// @return Background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureBackground() const;
+        const Texture& getTextureBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -260,7 +260,7 @@ namespace tgui
         /// @return Arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrow() const;
+        const Texture& getTextureArrow() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,7 +278,7 @@ namespace tgui
         /// @return Hover arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowHover() const;
+        const Texture& getTextureArrowHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
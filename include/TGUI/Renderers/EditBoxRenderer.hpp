@@ -454,7 +454,7 @@ namespace tgui
         /// @return edit box texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTexture() const;
+        const Texture& getTexture() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,7 +472,7 @@ namespace tgui
         /// @return hover texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureHover() const;
+        const Texture& getTextureHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,7 +490,7 @@ namespace tgui
         /// @return disabled texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureDisabled() const;
+        const Texture& getTextureDisabled() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,7 +508,7 @@ namespace tgui
         /// @return focused texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureFocused() const;
+        const Texture& getTextureFocused() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
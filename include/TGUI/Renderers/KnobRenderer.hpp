@@ -133,7 +133,7 @@ namespace tgui
         /// @return Background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureBackground() const;
+        const Texture& getTextureBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,7 +155,7 @@ namespace tgui
         /// @return Foreground texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureForeground() const;
+        const Texture& getTextureForeground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
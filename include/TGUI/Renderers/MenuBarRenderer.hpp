@@ -146,7 +146,7 @@ namespace tgui
         /// @return Background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureBackground() const;
+        const Texture& getTextureBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,7 +164,7 @@ namespace tgui
         /// @return Item background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureItemBackground() const;
+        const Texture& getTextureItemBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,7 +182,7 @@ namespace tgui
         /// @return Selected item background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureSelectedItemBackground() const;
+        const Texture& getTextureSelectedItemBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
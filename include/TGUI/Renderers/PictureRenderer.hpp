@@ -53,7 +53,7 @@ namespace tgui
         ///
         /// @return texture of the image
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTexture() const;
+        const Texture& getTexture() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,7 +173,7 @@ namespace tgui
         /// @return Background texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureBackground() const;
+        const Texture& getTextureBackground() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +193,7 @@ namespace tgui
         /// @return Fill texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureFill() const;
+        const Texture& getTextureFill() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
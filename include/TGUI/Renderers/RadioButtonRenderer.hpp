@@ -508,7 +508,7 @@ namespace tgui
         /// @return unchecked texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureUnchecked() const;
+        const Texture& getTextureUnchecked() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -528,7 +528,7 @@ namespace tgui
         /// @return checked texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureChecked() const;
+        const Texture& getTextureChecked() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,7 +548,7 @@ namespace tgui
         /// @return unchecked hover texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureUncheckedHover() const;
+        const Texture& getTextureUncheckedHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,7 +568,7 @@ namespace tgui
         /// @return checked hover texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureCheckedHover() const;
+        const Texture& getTextureCheckedHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -588,7 +588,7 @@ namespace tgui
         /// @return unchecked disabled texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureUncheckedDisabled() const;
+        const Texture& getTextureUncheckedDisabled() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -608,7 +608,7 @@ namespace tgui
         /// @return checked disabled texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureCheckedDisabled() const;
+        const Texture& getTextureCheckedDisabled() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -625,7 +625,7 @@ namespace tgui
         /// @brief Returns the image that is displayed on top of the checkbox when it is unchecked and focused
         /// @return focused texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureUncheckedFocused() const;
+        const Texture& getTextureUncheckedFocused() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -642,7 +642,7 @@ namespace tgui
         /// @brief Returns the image that is displayed on top of the checkbox when it is checked and focused
         /// @return focused texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureCheckedFocused() const;
+        const Texture& getTextureCheckedFocused() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -209,7 +209,7 @@ namespace tgui
         /// @return Track texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTrack() const;
+        const Texture& getTextureTrack() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,7 +227,7 @@ namespace tgui
         /// @return Hover track texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTrackHover() const;
+        const Texture& getTextureTrackHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -247,7 +247,7 @@ namespace tgui
         /// @return Thumb texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureThumb() const;
+        const Texture& getTextureThumb() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,7 +265,7 @@ namespace tgui
         /// @return Hover thumb texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureThumbHover() const;
+        const Texture& getTextureThumbHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,7 +285,7 @@ namespace tgui
         /// @return Up arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowUp() const;
+        const Texture& getTextureArrowUp() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,7 +303,7 @@ namespace tgui
         /// @return Hover up arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowUpHover() const;
+        const Texture& getTextureArrowUpHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -323,7 +323,7 @@ namespace tgui
         /// @return Down arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowDown() const;
+        const Texture& getTextureArrowDown() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,7 +341,7 @@ namespace tgui
         /// @return Hover down arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowDownHover() const;
+        const Texture& getTextureArrowDownHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,7 +183,7 @@ namespace tgui
         /// @return Track texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTrack() const;
+        const Texture& getTextureTrack() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,7 +201,7 @@ namespace tgui
         /// @return Hover track texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTrackHover() const;
+        const Texture& getTextureTrackHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,7 +221,7 @@ namespace tgui
         /// @return Thumb texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureThumb() const;
+        const Texture& getTextureThumb() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,7 +239,7 @@ namespace tgui
         /// @return Hover thumb texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureThumbHover() const;
+        const Texture& getTextureThumbHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,7 +187,7 @@ namespace tgui
         /// @return up arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowUp() const;
+        const Texture& getTextureArrowUp() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,7 +205,7 @@ namespace tgui
         /// @return up hover arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowUpHover() const;
+        const Texture& getTextureArrowUpHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,7 +225,7 @@ namespace tgui
         /// @return down arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowDown() const;
+        const Texture& getTextureArrowDown() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,7 +243,7 @@ namespace tgui
         /// @return down hover arrow texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureArrowDownHover() const;
+        const Texture& getTextureArrowDownHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
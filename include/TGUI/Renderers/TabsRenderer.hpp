@@ -267,7 +267,7 @@ namespace tgui
         /// @return tab texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTab() const;
+        const Texture& getTextureTab() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,7 +281,7 @@ namespace tgui
         /// @brief Returns the image of a tab when the mouse is on top of it
         /// @return hover tab texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureTabHover() const;
+        const Texture& getTextureTabHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,7 +301,7 @@ namespace tgui
         /// @return selected tab texture
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureSelectedTab() const;
+        const Texture& getTextureSelectedTab() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,7 +315,7 @@ namespace tgui
         /// @brief Returns the image of a selected tab when the mouse is on top of it
         /// @return selected hover tab texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureSelectedTabHover() const;
+        const Texture& getTextureSelectedTabHover() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,7 +331,7 @@ namespace tgui
         /// @brief Returns the image of a disabled tab
         /// @return disabled tab texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Texture& getTextureDisabledTab() const;
+        const Texture& getTextureDisabledTab() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,7 +224,7 @@ namespace tgui
         /// @brief Returns the image used in front of an expanded item
         /// @return The expanded branch texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        tgui::Texture& getTextureBranchExpanded() const;
+        const tgui::Texture& getTextureBranchExpanded() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +242,7 @@ namespace tgui
         /// @brief Returns the image used in front of a collapsed item
         /// @return The collapsed branch texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        tgui::Texture& getTextureBranchCollapsed() const;
+        const tgui::Texture& getTextureBranchCollapsed() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,7 +258,7 @@ namespace tgui
         /// @brief Returns the image used in front of a leaf item
         /// @return The lead item texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        tgui::Texture& getTextureLeaf() const;
+        const tgui::Texture& getTextureLeaf() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
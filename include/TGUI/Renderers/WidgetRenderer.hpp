@@ -30,11 +30,145 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/PropertyId.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    class Container;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Values of the properties of a renderer, stored in a flat table that is sorted on property id
+    ///
+    /// Properties can be accessed both by id and by name, the functions that take a name first look up the id of the name.
+    /// The names should be in lowercase.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyTable
+    {
+    public:
+
+        using value_type = std::pair<PropertyId, ObjectConverter>;
+        using iterator = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        PropertyTable() = default;
+
+        /// Creates the table from property-value pairs of which the names are in lowercase
+        PropertyTable(const std::map<std::string, ObjectConverter>& properties);
+
+        /// Returns all property-value pairs with the names of the properties
+        std::map<std::string, ObjectConverter> toMap() const;
+
+        iterator find(PropertyId property)
+        {
+            const auto it = lowerBound(property);
+            return ((it != m_values.end()) && (it->first == property)) ? it : m_values.end();
+        }
+
+        const_iterator find(PropertyId property) const
+        {
+            return const_cast<PropertyTable*>(this)->find(property);
+        }
+
+        iterator find(const std::string& property)
+        {
+            // Looking up a name never gives it an id, a name without an id can't be in the table
+            PropertyId id;
+            return tryGetPropertyId(property, id) ? find(id) : m_values.end();
+        }
+
+        const_iterator find(const std::string& property) const
+        {
+            return const_cast<PropertyTable*>(this)->find(property);
+        }
+
+        /// Returns the value of a property, the property is added with an empty value when it isn't in the table yet
+        ObjectConverter& operator[](PropertyId property)
+        {
+            const auto it = lowerBound(property);
+            if ((it != m_values.end()) && (it->first == property))
+                return it->second;
+            else
+                return m_values.emplace(it, property, ObjectConverter{})->second;
+        }
+
+        ObjectConverter& operator[](const std::string& property)
+        {
+            return (*this)[getPropertyId(property)];
+        }
+
+        /// Returns the value of a property, or throws std::out_of_range when the property isn't in the table
+        const ObjectConverter& at(PropertyId property) const
+        {
+            const auto it = find(property);
+            if (it == m_values.end())
+                throw std::out_of_range{"Property '" + getPropertyName(property) + "' isn't in the table"};
+
+            return it->second;
+        }
+
+        const ObjectConverter& at(const std::string& property) const
+        {
+            const auto it = find(property);
+            if (it == m_values.end())
+                throw std::out_of_range{"Property '" + property + "' isn't in the table"};
+
+            return it->second;
+        }
+
+        std::size_t count(PropertyId property) const
+        {
+            return (find(property) != m_values.end()) ? 1 : 0;
+        }
+
+        std::size_t count(const std::string& property) const
+        {
+            return (find(property) != m_values.end()) ? 1 : 0;
+        }
+
+        std::size_t erase(PropertyId property)
+        {
+            const auto it = find(property);
+            if (it == m_values.end())
+                return 0;
+
+            m_values.erase(it);
+            return 1;
+        }
+
+        /// Adds the properties from another table that aren't in this table yet, existing values are not overwritten
+        void insert(const PropertyTable& other);
+
+        iterator begin() { return m_values.begin(); }
+        iterator end() { return m_values.end(); }
+        const_iterator begin() const { return m_values.begin(); }
+        const_iterator end() const { return m_values.end(); }
+
+        std::size_t size() const { return m_values.size(); }
+        bool empty() const { return m_values.empty(); }
+        void clear() { m_values.clear(); }
+
+        bool operator==(const PropertyTable& other) const { return m_values == other.m_values; }
+        bool operator!=(const PropertyTable& other) const { return m_values != other.m_values; }
+
+    private:
+
+        iterator lowerBound(PropertyId property)
+        {
+            return std::lower_bound(m_values.begin(), m_values.end(), property,
+                                    [](const value_type& pair, PropertyId id){ return pair.first < id; });
+        }
+
+    private:
+
+        std::vector<value_type> m_values;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,22 +192,138 @@ namespace tgui
             for (const auto& pair : rendererNode->propertyValuePairs)
                 rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
 
+            // Nested renderers are created directly from their nodes instead of being stored as text that has to be parsed again
             for (const auto& nestedProperty : rendererNode->children)
             {
-                std::stringstream ss;
-                DataIO::emit(nestedProperty, ss);
-                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {sf::String{"{\n" + ss.str() + "}"}};
+                auto nestedRendererData = createFromDataIONode(nestedProperty.get());
+                nestedRendererData->shared = true;
+                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {std::move(nestedRendererData)};
             }
 
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        /// @internal
+        /// Returns the value of a property or a nullptr when the property isn't set.
+        /// Properties that were never changed in a copy-on-write renderer are found in the shared base.
+        const ObjectConverter* findProperty(PropertyId property) const
+        {
+            const auto it = propertyValuePairs.find(property);
+            if (it != propertyValuePairs.end())
+                return &it->second;
+
+            if (base)
+            {
+                const auto baseIt = base->find(property);
+                if (baseIt != base->end())
+                    return &baseIt->second;
+            }
+
+            return nullptr;
+        }
+
+        /// @internal
+        /// Returns the value of a property on which the getters of ObjectConverter can be called, or a nullptr when the property isn't set.
+        /// The shared base is never changed, a value from the base is copied into the temporary and converted there.
+        ObjectConverter* findConvertibleProperty(PropertyId property, ObjectConverter& temporary)
+        {
+            const auto it = propertyValuePairs.find(property);
+            if (it != propertyValuePairs.end())
+                return &it->second;
+
+            if (base)
+            {
+                const auto baseIt = base->find(property);
+                if (baseIt != base->end())
+                {
+                    temporary = baseIt->second;
+                    return &temporary;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// @internal
+        /// Returns the sorted ids of all properties, including the ones that are only stored in the shared base
+        std::vector<PropertyId> getPropertyIds() const
+        {
+            std::vector<PropertyId> properties;
+            properties.reserve(propertyValuePairs.size() + (base ? base->size() : 0));
+            for (const auto& pair : propertyValuePairs)
+                properties.push_back(pair.first);
+
+            if (base)
+            {
+                for (const auto& pair : *base)
+                    properties.push_back(pair.first);
+
+                std::inplace_merge(properties.begin(), properties.begin() + propertyValuePairs.size(), properties.end());
+                properties.erase(std::unique(properties.begin(), properties.end()), properties.end());
+            }
+
+            return properties;
+        }
+
+        /// @internal
+        /// Returns all properties with their names, including the ones that are only stored in the shared base, without changing the data
+        std::map<std::string, ObjectConverter> getAllProperties() const
+        {
+            if (!base)
+                return propertyValuePairs.toMap();
+
+            PropertyTable properties = propertyValuePairs;
+            properties.insert(*base);
+            return properties.toMap();
+        }
+
+        /// @internal
+        /// Copies the properties from the shared base into propertyValuePairs, so that propertyValuePairs contains all properties
+        void flatten()
+        {
+            if (!base)
+                return;
+
+            propertyValuePairs.insert(*base);
+            base = nullptr;
+        }
+
+        PropertyTable propertyValuePairs;
+        std::shared_ptr<const PropertyTable> base; // Shared values of the properties that aren't in propertyValuePairs, the set is never changed once created (see WidgetRenderer::createOverlay)
+        std::map<const void*, std::function<void(PropertyId property)>> observers;
+        std::map<const void*, std::function<void(const std::vector<PropertyId>& properties)>> batchObservers;
+        std::vector<PropertyId> pendingChanges; // Properties that changed since beginUpdate was called
+        unsigned int updateDepth = 0; // Amount of beginUpdate calls without matching endUpdate call
         bool shared = true;
     };
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the renderers that are used by widgets and the memory they take
+    ///
+    /// The statistics can be retrieved with Gui::getRendererStatistics. Renderers that are used by multiple widgets and
+    /// the shared properties of copy-on-write renderers (see WidgetRenderer::createOverlay) are only counted once.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API RendererStatistics
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Collects the statistics of the renderers of all widgets inside a container
+        ///
+        /// @param root  Container of which the widgets are examined (e.g. the container of the gui)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererStatistics(const Container& root);
+
+
+        std::size_t widgetCount = 0;     ///< Amount of widgets inside the container, including their tool tips
+        std::size_t rendererCount = 0;   ///< Amount of different renderers, including nested renderers (e.g. of scrollbars)
+        std::size_t sharedBaseCount = 0; ///< Amount of different property sets that are shared by copy-on-write renderers
+        std::size_t propertyCount = 0;   ///< Amount of property values stored in the renderers and shared property sets
+        std::size_t observerCount = 0;   ///< Amount of callback functions that are subscribed to the renderers
+        float sharingRatio = 0;          ///< Average amount of widgets that use the same renderer
+        std::size_t bytesUsed = 0;       ///< Estimated memory used by the renderers, excluding resources like textures and fonts
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for all renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,6 +428,55 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  Id of the property that you would like to change (e.g. PropertyId::BackgroundColor)
+        /// @param value     The new value that you like to assign to the property
+        ///
+        /// This is the same as calling setProperty with the name of the property, but without having to look up the name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(PropertyId property, ObjectConverter&& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes multiple properties of the renderer at once
+        ///
+        /// @param properties  Names of the properties that you would like to change together with their new values
+        ///
+        /// The widgets that use the renderer are only informed once about all changed properties instead of once per property.
+        /// This is the same as calling setProperty for every property between beginUpdate and endUpdate.
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperties(const std::map<std::string, ObjectConverter>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones informing the widgets about changed properties until endUpdate is called
+        ///
+        /// Calls to beginUpdate can be nested, the changes are only delivered when the outermost update ends.
+        /// @code
+        /// renderer->beginUpdate();
+        /// renderer->setBackgroundColor(sf::Color::Black);
+        /// renderer->setTextColor(sf::Color::White);
+        /// renderer->endUpdate(); // All widgets using the renderer are informed about both properties at once
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widgets about all properties that changed since beginUpdate was called
+        ///
+        /// Every subscriber is called once with the combined list of changed properties, each property is only listed once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -190,13 +489,25 @@ namespace tgui
         ObjectConverter getProperty(const std::string& property) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  Id of the property that you would like to retrieve (e.g. PropertyId::BackgroundColor)
+        ///
+        /// @return The value inside a ObjectConverter object or an ObjectConverter object with type ObjectConverter::Type::None
+        ///         when the property did not exist.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter getProperty(PropertyId property) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a map with all properties and their values
         ///
-        /// @return Property-value pairs of the renderer
+        /// @return Property-value pairs of the renderer, including the properties from the shared base of a copy-on-write renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,7 +517,20 @@ namespace tgui
         /// @param function Callback function to call when the renderer changes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
+        void subscribe(const void* id, const std::function<void(PropertyId property)>& function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Subscribes a callback function that receives all properties that were changed together at once
+        ///
+        /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
+        /// @param function Callback function to call when the renderer changes
+        ///
+        /// When a single property is changed, the callback is called with a list containing only that property.
+        /// The name of a property can be found with getPropertyName.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribeBatched(const void* id, const std::function<void(const std::vector<PropertyId>& properties)>& function);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,11 +567,37 @@ namespace tgui
         /// @brief Gets a clone of the renderer data
         ///
         /// You can pass this to a widget with the setRenderer function to have a separate non-shared copy of this renderer.
+        /// The propertyValuePairs of the clone contain all properties, even when this renderer is a copy-on-write renderer.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::shared_ptr<RendererData> clone() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets a copy-on-write copy of the renderer data
+        ///
+        /// The returned renderer only stores the properties that are changed afterwards, the other properties are read from
+        /// an immutable copy of this renderer. Renderers with identical properties share the same immutable copy, so a widget
+        /// that only overrides a single property of its theme doesn't need its own copy of all other properties.
+        /// This is what the getRenderer function of the widget uses when it stops sharing the renderer.
+        ///
+        /// Code that accesses the propertyValuePairs member of the data directly should call flatten on it first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<RendererData> createOverlay() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the subscribers about a changed property, or remembers it when an update is in progress
+        ///
+        /// @param property  Id of the property that was changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void propertyChanged(PropertyId property);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -32,12 +32,14 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Animation.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <functional>
-#include <typeindex>
+#include <cstddef>
 #include <memory>
 #include <vector>
-#include <deque>
 #include <map>
+#include <unordered_map>
+#include <atomic>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,7 +51,34 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        // Type to pass a list of template types
+        template <typename...>
+        struct TypeSet;
+
+        // Types of the values sent by every kind of signal. A signal handler that is connected by signal name computes at compile time
+        // where its parameters are located for each entry in this list, the signal only has to tell which entry it corresponds to.
+        using SignalParameterTypes = TypeSet<TypeSet<>,
+                                             TypeSet<int>,
+                                             TypeSet<unsigned int>,
+                                             TypeSet<bool>,
+                                             TypeSet<float>,
+                                             TypeSet<sf::String>,
+                                             TypeSet<Vector2f>,
+                                             TypeSet<float, float>,
+                                             TypeSet<std::shared_ptr<ChildWindow>>,
+                                             TypeSet<sf::String, sf::String>,
+                                             TypeSet<ShowAnimationType, bool>,
+                                             TypeSet<sf::String, std::vector<sf::String>>>;
+
+        // Finds the index of a type in a list of types
+        template <typename Type, typename List>
+        struct indexOf;
+
+        template <typename Type, typename... Types>
+        struct indexOf<Type, TypeSet<Type, Types...>> : std::integral_constant<std::size_t, 0> {};
+
+        template <typename Type, typename First, typename... Types>
+        struct indexOf<Type, TypeSet<First, Types...>> : std::integral_constant<std::size_t, 1 + indexOf<Type, TypeSet<Types...>>::value> {};
     }
 
 
@@ -63,21 +92,35 @@ namespace tgui
         using Delegate = std::function<void()>;
         using DelegateEx = std::function<void(std::shared_ptr<Widget>, const std::string&)>;
 
+        /// Function that gets pointers to the values sent by the signal, the first value is always the widget
+        using Handler = std::function<void(const void* const* parameters)>;
 
-        virtual ~Signal() = default;
+        /// Types of the values that the signal sends to its handlers, apart from the widget
+        using Parameters = internal_signal::TypeSet<>;
+
+        /// When the signal handlers are called after the signal is emitted
+        enum class Delivery
+        {
+            Immediate,   ///< The signal handlers are called from within the emit (default)
+            Queued,      ///< Every emit is stored and the signal handlers are called when the queued emits are dispatched
+            QueuedLatest ///< Like Queued, but multiple emits before the dispatch are collapsed into one with the latest values
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~Signal();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
+        Signal(std::string&& name) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
         }
 
 
@@ -125,6 +168,28 @@ namespace tgui
         unsigned int connect(const DelegateEx& handler);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a signal handler that accesses the values sent by the signal directly
+        ///
+        /// @param handler  Callback function that is given pointers to the widget and the values sent by the signal
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectHandler(const Handler& handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a signal handler that may be shared with other signals
+        ///
+        /// @param handler  Callback function that is given pointers to the widget and the values sent by the signal
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectHandler(std::shared_ptr<const Handler> handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect a signal handler from this signal
         ///
@@ -150,18 +215,80 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty())
-                return false;
+            return emitValues(widget);
+        }
 
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
 
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes when the signal handlers are called after the signal is emitted
+        ///
+        /// @param delivery  Whether the handlers are called immediately or from the next dispatch of the queued emits
+        ///
+        /// Queued signals are dispatched by the Gui::draw function of the gui that contains the widget, so that expensive
+        /// signal handlers are no longer executed in the middle of e.g. handling an event, and they are called at most once
+        /// per frame when using Delivery::QueuedLatest.
+        /// Note that emit returns true when the emit is queued, so the sender acts as if the signal was handled. A ChildWindow
+        /// whose onClose signal is queued will e.g. not close itself.
+        ///
+        /// The widget that emitted the signal has to be owned by a shared_ptr for the emit to be queued. Signals of widgets that
+        /// have been destroyed before the queue is dispatched are dropped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDelivery(Delivery delivery);
 
-            return true;
-        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns when the signal handlers are called after the signal is emitted
+        ///
+        /// @return Whether the handlers are called immediately or from the next dispatch of the queued emits
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Delivery getDelivery() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the signal handlers of all signals that were queued since the last dispatch
+        ///
+        /// Signals that are emitted by the handlers while dispatching are queued again and will only be dispatched the next
+        /// time this function is called.
+        ///
+        /// Every thread has its own queue, only the signals that were emitted on the calling thread are dispatched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void dispatchQueuedEmits();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the signal handlers of the queued signals of the widgets inside a root widget
+        ///
+        /// @param root  Top-most parent of the widgets (e.g. the container of a gui)
+        ///
+        /// This function is called by Gui::draw with the container of the gui, so that every gui only dispatches the signals
+        /// of its own widgets, even when multiple guis are used on the same thread. The widgets are checked against the root
+        /// when dispatching, so signals emitted before a widget was added to the gui are dispatched as well. Signals that are
+        /// emitted by the handlers while dispatching are queued again and will only be dispatched the next time this function
+        /// is called. Queued signals of widgets that were destroyed in the meantime are discarded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void dispatchQueuedEmits(const Widget* root);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts or stops collecting statistics about the emitted signals and layout evaluations of all widgets
+        ///
+        /// @param enabled  Should the amount of emits and the time spent in the signal handlers be recorded?
+        ///
+        /// The statistics can be retrieved with Gui::getSignalProfile and Gui::getLayoutGraph. Stopping the profiling doesn't
+        /// clear the statistics. While profiling is disabled, the only overhead when emitting a signal or evaluating a layout
+        /// is checking this flag.
+        ///
+        /// The flag is shared by all threads, but the statistics are collected per thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setProfilingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether statistics about the emitted signals are being collected
+        ///
+        /// @return Is the amount of emits and the time spent in the signal handlers being recorded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isProfilingEnabled();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,10 +304,28 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t getParametersIndex() const
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const;
+        static std::shared_ptr<Widget> getWidget(const void* const* parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Disconnects a signal handler from the widget stored in the first parameter
+        ///
+        /// This is used by signal handlers that notice during an emit that they are no longer needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void disconnectFromSender(const void* const* parameters, unsigned int id);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,16 +333,139 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Extracts the widget stored in the first parameter
+        /// @brief Calls the connected signal handlers with the given values or queues the emit, depending on the delivery
+        ///
+        /// @param widget  The sender of the signal
+        /// @param values  Values that are sent by the signal, they are copied when the emit is queued
+        ///
+        /// The delegated handlers of the parents of the widget are called (or queued) together with the handlers of the signal.
+        ///
+        /// @return True when at least one handler connected to this signal was called or will be called when the queue is
+        ///         dispatched. Delegated handlers of the parents don't count, they can't mark the signal as handled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename... Values>
+        bool emitValues(const Widget* widget, const Values&... values)
+        {
+            if (m_profilingEnabled)
+                recordEmit(widget);
+
+            if (m_delivery != Delivery::Immediate)
+            {
+                if (!m_handlers && ((m_delegatedHandlerCount == 0) || !findDelegatedHandlers(widget)))
+                    return false;
+
+                const bool handled = (m_handlers != nullptr);
+                queueEmit(widget, [this, values...](const Widget* sender){
+                        // The parents are searched before calling the handlers, because a handler could remove the widget from its parent
+                        const auto delegatedHandlers = (m_delegatedHandlerCount > 0) ? findDelegatedHandlers(sender) : nullptr;
+
+                        const void* parameters[] = {static_cast<const void*>(&sender), static_cast<const void*>(&values)...};
+                        callHandlers(parameters);
+
+                        if (delegatedHandlers)
+                            delegatedHandlers();
+                    });
+
+                return handled;
+            }
+
+            // The parents are searched before calling the handlers, because a handler could remove the widget from its parent
+            const auto delegatedHandlers = (m_delegatedHandlerCount > 0) ? findDelegatedHandlers(widget) : nullptr;
+
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&values)...};
+            const bool handled = callHandlers(parameters);
+
+            if (delegatedHandlers)
+                delegatedHandlers();
+
+            return handled;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Call all connected signal handlers with the given values
+        ///
+        /// @param parameters  Pointers to the widget and the values that are sent by the signal
+        ///
+        /// @return True when at least one signal handler was called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static std::shared_ptr<Widget> getWidget();
+        bool callHandlers(const void* const* parameters)
+        {
+            if (!m_handlers)
+                return false;
+
+            if (m_profilingEnabled)
+                return callHandlersProfiled(parameters);
+
+            // Keep a reference to the handlers in case the widget (and this signal) gets destroyed during the handler.
+            // Handlers that are connected or disconnected while emitting will change a copy of the list instead.
+            const auto handlers = m_handlers;
+            for (const auto& handler : *handlers)
+                (*handler.second)(parameters);
+
+            return true;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds a signal handler with the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addHandler(unsigned int id, Handler handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the list of handlers that can be changed without affecting a signal that is currently being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::pair<unsigned int, std::shared_ptr<const Handler>>>& getWritableHandlers();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the emit until the queued emits are dispatched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool queueEmit(const Widget* widget, std::function<void(const Widget*)> emit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Increments the emit count of this signal while profiling
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recordEmit(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the signal handlers while measuring how long they take
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool callHandlersProfiled(const void* const* parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Collects the delegated handlers of the parents of the widget that are connected to this signal.
+        // Returns an empty function when none of the parents has a delegated handler for this signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::function<void()> findDelegatedHandlers(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a new id for a connection, used by containers to give delegated handlers an id that differs from all handlers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int generateConnectionId();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<std::vector<std::pair<unsigned int, std::shared_ptr<const Handler>>>> m_handlers = nullptr; // Sorted on id, nullptr when no handlers are connected
+        Delivery m_delivery = Delivery::Immediate;
+
+        static std::atomic<bool> m_profilingEnabled;
+        static std::atomic<unsigned int> m_delegatedHandlerCount; // Total amount of handlers that containers have for signals of their children
+
+        friend class Container; // Containers update the delegated handler count
     };
 
 #ifdef TGUI_REMOVE_DEPRECATED_CODE
@@ -208,11 +476,13 @@ namespace tgui
     class TGUI_API Signal##TypeName : public Signal \
     { \
     public: \
+        using Parameters = internal_signal::TypeSet<typename std::decay<Type>::type>; \
+        \
         /************************************************************************************************************************ \
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -222,20 +492,18 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            return emitValues(widget, param); \
         } \
         \
     private: \
         /************************************************************************************************************************ \
          * @internal
-         * @brief Checks whether the unbound parameters match with this signal
-         * @return The index in the parameters list where the parameters will be stored
+         * @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
          ************************************************************************************************************************/ \
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override; \
+        std::size_t getParametersIndex() const override \
+        { \
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value; \
+        } \
     };
 #else
     #define TGUI_SIGNAL_VALUE_DECLARATION(TypeName, Type) \
@@ -249,11 +517,13 @@ namespace tgui
         using Delegate##TypeName##Ex = std::function<void(std::shared_ptr<Widget>, const std::string&, Type)>; \
         using Signal::connect; \
         \
+        using Parameters = internal_signal::TypeSet<typename std::decay<Type>::type>; \
+        \
         /************************************************************************************************************************ \
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -281,20 +551,18 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            return emitValues(widget, param); \
         } \
         \
     private: \
         /************************************************************************************************************************ \
          * @internal
-         * @brief Checks whether the unbound parameters match with this signal
-         * @return The index in the parameters list where the parameters will be stored
+         * @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
          ************************************************************************************************************************/ \
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override; \
+        std::size_t getParametersIndex() const override \
+        { \
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value; \
+        } \
     };
 #endif
 
@@ -319,11 +587,13 @@ namespace tgui
         using Signal::connect;
     #endif
 
+        using Parameters = internal_signal::TypeSet<float, float>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalRange(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -359,10 +629,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override;
+        std::size_t getParametersIndex() const override
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,11 +654,13 @@ namespace tgui
         using Signal::connect;
     #endif
 
+        using Parameters = internal_signal::TypeSet<std::shared_ptr<ChildWindow>>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalChildWindow(std::string&& name) :
-            Signal{std::move(name), 1}
+            Signal{std::move(name)}
         {
         }
 
@@ -422,10 +696,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override;
+        std::size_t getParametersIndex() const override
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,11 +723,13 @@ namespace tgui
         using Signal::connect;
     #endif
 
+        using Parameters = internal_signal::TypeSet<sf::String, sf::String>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -502,12 +780,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            return Signal::emit(widget);
+            return emitValues(widget, item, id);
         }
 
 
@@ -515,10 +788,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override;
+        std::size_t getParametersIndex() const override
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -537,11 +812,13 @@ namespace tgui
     {
     public:
 
+        using Parameters = internal_signal::TypeSet<ShowAnimationType, bool>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalAnimation(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -551,12 +828,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&type);
-            internal_signal::parameters[2] = static_cast<const void*>(&visible);
-            return Signal::emit(widget);
+            return emitValues(widget, type, visible);
         }
 
 
@@ -564,10 +836,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override;
+        std::size_t getParametersIndex() const override
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -589,11 +863,13 @@ namespace tgui
         using Signal::connect;
     #endif
 
+        using Parameters = internal_signal::TypeSet<sf::String, std::vector<sf::String>>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItemHierarchy(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -644,12 +920,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            return emitValues(widget, item, fullItem);
         }
 
 
@@ -657,10 +928,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Checks whether the unbound parameters match with this signal
-        /// @return The index in the parameters list where the parameters will be stored
+        /// @brief Returns the index of the types of the values that this signal sends in internal_signal::SignalParameterTypes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const override;
+        std::size_t getParametersIndex() const override
+        {
+            return internal_signal::indexOf<Parameters, internal_signal::SignalParameterTypes>::value;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,6 +944,139 @@ namespace tgui
 #endif
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Connection that is disconnected automatically when it goes out of scope
+    ///
+    /// @code
+    /// tgui::ScopedConnection connection{button, button->connect("Pressed", [&]{ document.save(); })};
+    /// @endcode
+    ///
+    /// The connection only keeps a weak reference to the widget, so it doesn't keep the widget alive and it can safely
+    /// outlive the widget.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ScopedConnection
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that doesn't hold a connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScopedConnection() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Takes ownership of a connection
+        ///
+        /// @param widget  Widget to which the signal handler was connected
+        /// @param id      Id of the connection, as returned by the connect function of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScopedConnection(const std::shared_ptr<Widget>& widget, unsigned int id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor, the other object no longer holds the connection afterwards
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScopedConnection(ScopedConnection&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator, the connection that was held before is disconnected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScopedConnection& operator=(ScopedConnection&& other);
+
+
+        ScopedConnection(const ScopedConnection&) = delete;
+        ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor which disconnects the signal handler
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ScopedConnection();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disconnects the signal handler now instead of when the object is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnect();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops managing the connection without disconnecting the signal handler
+        ///
+        /// @return Id of the connection, or 0 when no connection was held
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int release();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of the connection
+        ///
+        /// @return Id of the connection, or 0 when no connection is held
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getId() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::weak_ptr<Widget> m_widget;
+        unsigned int m_id = 0;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the signals that were emitted while profiling was enabled
+    ///
+    /// The profile can be retrieved with Gui::getSignalProfile after calling Signal::setProfilingEnabled(true).
+    /// It contains an entry for every signal of the widgets in the gui that was emitted since the statistics were last reset.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API SignalProfile
+    {
+        /// Statistics of a single signal
+        struct Entry
+        {
+            const Widget* widget = nullptr;     ///< Widget that owns the signal
+            std::string widgetName;             ///< Name of the widget in its parent, or its type when it has no name
+            std::string signalName;             ///< Name of the signal
+            unsigned int emits = 0;             ///< Amount of times the signal was emitted
+            unsigned int handlerCalls = 0;      ///< Amount of times a signal handler was called, summed over all emits
+            sf::Time handlerTime;               ///< Total time spent inside the signal handlers
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Collects the statistics of the signals of a widget and all widgets inside it
+        ///
+        /// @param root             Widget for which the profile is created (e.g. the container of the gui)
+        /// @param resetStatistics  Should the statistics of these signals be reset after retrieving them?
+        ///
+        /// The entries are sorted on the time spent in their handlers, with the most expensive signal first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalProfile(const Widget& root, bool resetStatistics);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the profile to comma-separated values, with one line per signal below a header line
+        ///
+        /// @return Profile in CSV format, the handler time is given in microseconds
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string toCsv() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the profile to a JSON array with an object per signal
+        ///
+        /// @return Profile in JSON format, the handler time is given in microseconds
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string toJson() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        std::vector<Entry> entries;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for Widget which provides functionality to connect signals based on their name
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -691,7 +1097,7 @@ namespace tgui
         /// @return Unique id of the connection
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename Func, typename... BoundArgs>
-        unsigned int connect(std::string signalName, Func&& handler, const BoundArgs&... args);
+        unsigned int connect(const std::string& signalName, Func&& handler, const BoundArgs&... args);
 
 #else
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -704,7 +1110,7 @@ namespace tgui
         /// @return Unique id of the connection
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename Func, typename... Args, typename std::enable_if<std::is_convertible<Func, std::function<void(const Args&...)>>::value>::type* = nullptr>
-        unsigned int connect(std::string signalName, Func&& handler, const Args&... args);
+        unsigned int connect(const std::string& signalName, Func&& handler, const Args&... args);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -718,7 +1124,7 @@ namespace tgui
         /// @return Unique id of the connection
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename Func, typename... BoundArgs, typename std::enable_if<std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type* = nullptr>
-        unsigned int connect(std::string signalName, Func&& handler, BoundArgs&&... args);
+        unsigned int connect(const std::string& signalName, Func&& handler, BoundArgs&&... args);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -732,7 +1138,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename Func, typename... BoundArgs, typename std::enable_if<!std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value
                                                                              && !std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type* = nullptr>
-        unsigned int connect(std::string signalName, Func&& handler, BoundArgs&&... args);
+        unsigned int connect(const std::string& signalName, Func&& handler, BoundArgs&&... args);
 #endif
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -748,6 +1154,81 @@ namespace tgui
         unsigned int connect(std::initializer_list<std::string> signalNames, Func&& handler, BoundArgs&&... args);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler to a signal of this widget, checking the parameters of the handler at compile time
+        ///
+        /// @param signal   The signal of this widget to connect to (e.g. button->onPress)
+        /// @param handler  Callback function
+        /// @param args     Optional extra arguments to pass to the signal handler when the signal is emitted
+        ///
+        /// Unlike the connect functions that take a signal name, a handler with parameters that the signal doesn't send results
+        /// in a compile error instead of an exception. The handler must have a single signature, so it can't be a generic lambda.
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename SignalType, typename Func, typename... BoundArgs, typename std::enable_if<std::is_base_of<Signal, SignalType>::value>::type* = nullptr>
+        unsigned int connect(SignalType& signal, Func&& handler, BoundArgs&&... args);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler that is only called as long as the receiver object exists
+        ///
+        /// @param signalName   Name of the signal
+        /// @param receiver     Object that the signal handler belongs to
+        /// @param handler      Member function of the receiver, or any other callback function that uses the receiver
+        /// @param args         Optional extra arguments to pass to the signal handler when the signal is emitted
+        ///
+        /// Only a weak reference to the receiver is kept, so the connection doesn't keep the receiver alive. When the signal
+        /// is emitted after the receiver was destroyed, the handler is not called and is disconnected automatically.
+        /// When the handler is a member function of the receiver, it is called on the receiver object.
+        ///
+        /// @code
+        /// button->connectWeak("Pressed", controller, &Controller::save); // controller is a std::shared_ptr<Controller>
+        /// @endcode
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Receiver, typename Func, typename... BoundArgs>
+        unsigned int connectWeak(const std::string& signalName, const std::weak_ptr<Receiver>& receiver, Func&& handler, BoundArgs&&... args);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler that is only called as long as the receiver object exists
+        ///
+        /// @param signalName   Name of the signal
+        /// @param receiver     Object that the signal handler belongs to, the connection only keeps a weak reference to it
+        /// @param handler      Member function of the receiver, or any other callback function that uses the receiver
+        /// @param args         Optional extra arguments to pass to the signal handler when the signal is emitted
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Receiver, typename Func, typename... BoundArgs>
+        unsigned int connectWeak(const std::string& signalName, const std::shared_ptr<Receiver>& receiver, Func&& handler, BoundArgs&&... args)
+        {
+            return connectWeak(signalName, std::weak_ptr<Receiver>(receiver), std::forward<Func>(handler), std::forward<BoundArgs>(args)...);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects the same signal handler to a signal of multiple widgets
+        ///
+        /// @param widgets      List of widgets to connect to (e.g. a std::vector<Button::Ptr>)
+        /// @param signalName   Name of the signal
+        /// @param handler      Callback function
+        /// @param args         Optional extra arguments to pass to the signal handler when the signal is emitted
+        ///
+        /// The handler is only created once and is shared by all widgets that have the same signal type, which is a lot
+        /// cheaper than calling connect on every widget when connecting to thousands of widgets.
+        /// The handler must have a single signature, so it can't be a generic lambda.
+        ///
+        /// @return Unique ids of the connections, in the same order as the widgets
+        ///
+        /// @throw Exception when one of the widgets doesn't have a signal with this name or the handler parameters don't match
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetList, typename Func, typename... BoundArgs>
+        static std::vector<unsigned int> connectAll(const WidgetList& widgets, const std::string& signalName, Func&& handler, BoundArgs&&... args);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnects a signal handler
         ///
@@ -763,7 +1244,7 @@ namespace tgui
         ///
         /// @param signalName   Name of the signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void disconnectAll(std::string signalName);
+        void disconnectAll(const std::string& signalName);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -775,16 +1256,94 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Table to find the signals of a widget type based on their lowercase name
+        ///
+        /// Widgets keep a static table in their getSignal function, so that the names of their signals only have to be
+        /// converted to lowercase once per widget type instead of on every lookup:
+        /// @code
+        /// static const SignalTable<Button> signals{*this, &Button::onPress};
+        /// if (Signal* signal = signals.find(*this, signalName))
+        ///     return *signal;
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        class SignalTable
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// @param widget   Widget from which the names of the signals are read
+            /// @param signals  Pointers to the signal members of the widget type
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            template <typename... SignalMembers>
+            SignalTable(WidgetType& widget, SignalMembers... signals)
+            {
+                m_signals.reserve(sizeof...(SignalMembers));
+                const auto unused = {(addSignal(widget, signals), 0)...};
+                (void)unused;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Finds the signal of the widget with the given name
+            ///
+            /// @param widget         Widget that contains the signal
+            /// @param lowercaseName  Name of the signal, converted to lowercase
+            ///
+            /// @return The signal of the widget, or nullptr when the table doesn't contain a signal with this name
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Signal* find(WidgetType& widget, const std::string& lowercaseName) const
+            {
+                const auto it = m_signals.find(lowercaseName);
+                if (it != m_signals.end())
+                    return &it->second(widget);
+                else
+                    return nullptr;
+            }
+
+        private:
+
+            template <typename SignalType, typename Class>
+            void addSignal(WidgetType& widget, SignalType Class::* signal)
+            {
+                m_signals[toLower((widget.*signal).getName())] = [signal](WidgetType& w) -> Signal& { return w.*signal; };
+            }
+
+            std::unordered_map<std::string, std::function<Signal&(WidgetType&)>> m_signals;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
+        ///
+        /// @param signalName  Name of the signal, converted to lowercase
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Signal& getSignal(const std::string& signalName) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers to which signal the connection with the given id was made
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addConnection(unsigned int id, const Signal& signal);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the signal member that is stored at the given offset from this object
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual Signal& getSignal(std::string signalName) = 0;
+        Signal& getSignalAtOffset(std::ptrdiff_t offset);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::map<unsigned int, std::string> m_connectedSignals;
+        // Offsets of the connected signals from this object, sorted on connection id. Unlike a pointer to the signal, the offset
+        // remains valid when the widget is copied or moved.
+        std::vector<std::pair<unsigned int, std::ptrdiff_t>> m_connectedSignals;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
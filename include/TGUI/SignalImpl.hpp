@@ -42,10 +42,6 @@ namespace tgui
         using void_t = void;
     #endif
 
-        // Type to pass a list of template types
-        template <typename...>
-        struct TypeSet;
-
         // The dereference function turns the void* elements in the parameters list back into its original type right before calling the signal handler
     #ifdef TGUI_USE_CPP17
         template <typename Type>
@@ -96,6 +92,61 @@ namespace tgui
         }
     #endif
 
+        // Checks whether a parameter of a signal handler can receive a value that the signal sends
+        template <typename HandlerArg, typename SignalArg>
+        struct isCompatible : std::is_same<HandlerArg, SignalArg> {};
+
+        // Signal handlers are allowed to have std::string and sf::Vector2f parameters while the signal sends sf::String and tgui::Vector2f
+        template <>
+        struct isCompatible<std::string, sf::String> : std::true_type {};
+
+        template <>
+        struct isCompatible<sf::Vector2f, Vector2f> : std::true_type {};
+
+        // Checks whether the unbound parameters can be filled with the first values sent by the signal
+        template <typename UnboundArgs, typename SignalArgs>
+        struct matchesFirstParameters : std::false_type {};
+
+        template <typename... SignalArgs>
+        struct matchesFirstParameters<TypeSet<>, TypeSet<SignalArgs...>> : std::true_type {};
+
+        template <typename Arg, typename... Args, typename SignalArg, typename... SignalArgs>
+        struct matchesFirstParameters<TypeSet<Arg, Args...>, TypeSet<SignalArg, SignalArgs...>>
+            : std::integral_constant<bool, isCompatible<Arg, SignalArg>::value && matchesFirstParameters<TypeSet<Args...>, TypeSet<SignalArgs...>>::value>
+        {
+        };
+
+        // Finds the index of the value sent by the signal from which the unbound parameters are filled, or 0 when they don't match
+        template <std::size_t Offset, typename UnboundArgs, typename SignalArgs>
+        struct findParameterOffset : std::integral_constant<std::size_t, 0> {};
+
+        template <std::size_t Offset, typename... UnboundArgs, typename SignalArg, typename... SignalArgs>
+        struct findParameterOffset<Offset, TypeSet<UnboundArgs...>, TypeSet<SignalArg, SignalArgs...>>
+            : std::integral_constant<std::size_t, matchesFirstParameters<TypeSet<UnboundArgs...>, TypeSet<SignalArg, SignalArgs...>>::value
+                                                  ? Offset
+                                                  : findParameterOffset<Offset + 1, TypeSet<UnboundArgs...>, TypeSet<SignalArgs...>>::value>
+        {
+        };
+
+        // Finds where the unbound parameters are located in the values sent by a signal of which the type is only known at runtime.
+        // The offsets for every kind of signal are computed at compile time, the signal only selects the entry that applies to it.
+        template <typename UnboundArgs, typename SignalParameterList>
+        struct parameterOffset;
+
+        template <typename UnboundArgs, typename... SignalParameters>
+        struct parameterOffset<UnboundArgs, TypeSet<SignalParameters...>>
+        {
+            static std::size_t get(const Signal& signal)
+            {
+                static constexpr std::size_t offsets[] = {findParameterOffset<1, UnboundArgs, SignalParameters>::value...};
+                const std::size_t offset = offsets[signal.getParametersIndex()];
+                if (offset == 0)
+                    throw Exception{"Signal '" + signal.getName() + "' could not provide data for unbound parameters."};
+
+                return offset;
+            }
+        };
+
         // The binder will figure out the unbound parameters and bind them if they correspond to what the signal sends
         template <typename... Args>
         struct binder;
@@ -109,32 +160,40 @@ namespace tgui
         template <typename... UnboundArgs>
         struct binder<TypeSet<std::shared_ptr<Widget>, std::string, UnboundArgs...>, TypeSet<>>
         {
+            using Unbound = TypeSet<UnboundArgs...>;
+
             template <typename Func, typename... BoundArgs>
             static decltype(auto) bind(Signal& signal, Func&& func, BoundArgs&&... args)
             {
-                return bindImpl(std::index_sequence_for<UnboundArgs...>{}, signal, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
+                const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? parameterOffset<Unbound, SignalParameterTypes>::get(signal) : 0;
+                return bindAtOffset(signal.getName(), offset, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
+            }
+
+            template <typename Func, typename... BoundArgs>
+            static decltype(auto) bindAtOffset(const std::string& signalName, std::size_t offset, Func&& func, BoundArgs&&... args)
+            {
+                return bindImpl(std::index_sequence_for<UnboundArgs...>{}, signalName, offset, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
             }
 
         private:
 
             template <typename Func, typename... BoundArgs, std::size_t... Indices>
-            static decltype(auto) bindImpl(std::index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
+            static decltype(auto) bindImpl(std::index_sequence<Indices...>, const std::string& signalName, std::size_t offset, Func&& func, BoundArgs&&... args)
             {
-                const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #if defined TGUI_USE_CPP17
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=](const void* const* parameters) {
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                 args...,
-                                widget,
+                                Signal::getWidget(parameters),
                                 signalName,
-                                internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                                internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset,name=signalName](const void* const* parameters) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               widget,
-                               signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               Signal::getWidget(parameters),
+                               name,
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -143,28 +202,36 @@ namespace tgui
         template <typename... UnboundArgs>
         struct binder<TypeSet<UnboundArgs...>, TypeSet<>>
         {
+            using Unbound = TypeSet<UnboundArgs...>;
+
             template <typename Func, typename... BoundArgs>
             static decltype(auto) bind(Signal& signal, Func&& func, BoundArgs&&... args)
             {
-                return bindImpl(std::index_sequence_for<UnboundArgs...>{}, signal, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
+                const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? parameterOffset<Unbound, SignalParameterTypes>::get(signal) : 0;
+                return bindAtOffset(signal.getName(), offset, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
+            }
+
+            template <typename Func, typename... BoundArgs>
+            static decltype(auto) bindAtOffset(const std::string&, std::size_t offset, Func&& func, BoundArgs&&... args)
+            {
+                return bindImpl(std::index_sequence_for<UnboundArgs...>{}, offset, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
             }
 
         private:
 
             template <typename Func, typename... BoundArgs, std::size_t... Indices>
-            static decltype(auto) bindImpl(std::index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
+            static decltype(auto) bindImpl(std::index_sequence<Indices...>, std::size_t offset, Func&& func, BoundArgs&&... args)
             {
-                const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #if defined TGUI_USE_CPP17
-                return [=]{
+                return [=](const void* const* parameters){
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset]{ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset](const void* const* parameters){ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -270,13 +337,28 @@ namespace tgui
         {
         };
     #endif
+
+        // Binds a handler to a signal and passes the receiver as first argument when the handler is a member function
+        template <typename Receiver, typename Func, typename... BoundArgs>
+        decltype(auto) bindWithReceiver(std::true_type, Signal& signal, Receiver* receiver, Func&& func, BoundArgs&&... args)
+        {
+            using binder = func_traits<void, typename std::decay<Func>::type, Receiver*, BoundArgs...>;
+            return binder::bind(signal, std::forward<Func>(func), receiver, std::forward<BoundArgs>(args)...);
+        }
+
+        template <typename Receiver, typename Func, typename... BoundArgs>
+        decltype(auto) bindWithReceiver(std::false_type, Signal& signal, Receiver*, Func&& func, BoundArgs&&... args)
+        {
+            using binder = func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
+            return binder::bind(signal, std::forward<Func>(func), std::forward<BoundArgs>(args)...);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #ifdef TGUI_USE_CPP17
     template <typename Func, typename... BoundArgs>
-    unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const BoundArgs&... args)
+    unsigned int SignalWidgetBase::connect(const std::string& signalName, Func&& handler, const BoundArgs&... args)
     {
         unsigned int id;
         Signal& signal = getSignal(toLower(signalName));
@@ -309,55 +391,132 @@ namespace tgui
         {
             // Function with unbound arguments
             using binder = internal_signal::func_traits<void, std::decay_t<Func>, BoundArgs...>;
-            id = signal.connect(binder::bind(signal, std::forward<Func>(handler), args...));
+            id = signal.connectHandler(binder::bind(signal, std::forward<Func>(handler), args...));
         }
 
-        m_connectedSignals[id] = toLower(signalName);
+        addConnection(id, signal);
         return id;
     }
 
 #else
     template <typename Func, typename... Args, typename std::enable_if<std::is_convertible<Func, std::function<void(const Args&...)>>::value>::type*>
-    unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const Args&... args)
+    unsigned int SignalWidgetBase::connect(const std::string& signalName, Func&& handler, const Args&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
-        m_connectedSignals[id] = toLower(signalName);
+        Signal& signal = getSignal(toLower(signalName));
+        const unsigned int id = signal.connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
+        addConnection(id, signal);
         return id;
     }
 
     template <typename Func, typename... BoundArgs, typename std::enable_if<std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
-    unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
+    unsigned int SignalWidgetBase::connect(const std::string& signalName, Func&& handler, BoundArgs&&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect(
+        Signal& signal = getSignal(toLower(signalName));
+        const unsigned int id = signal.connect(
                                     [f=std::function<void(const BoundArgs&..., const std::shared_ptr<Widget>&, const std::string&)>(handler), args...]
                                     (const std::shared_ptr<Widget>& w, const std::string& s)
                                     { f(args..., w, s); }
                                 );
 
-        m_connectedSignals[id] = toLower(signalName);
+        addConnection(id, signal);
         return id;
     }
 
     template <typename Func, typename... BoundArgs, typename std::enable_if<!std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value
                                                                          && !std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
-    unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
+    unsigned int SignalWidgetBase::connect(const std::string& signalName, Func&& handler, BoundArgs&&... args)
     {
         Signal& signal = getSignal(toLower(signalName));
         using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
-        const unsigned int id = signal.connect(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
-        m_connectedSignals[id] = toLower(signalName);
+        const unsigned int id = signal.connectHandler(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        addConnection(id, signal);
         return id;
     }
 #endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    template <typename SignalType, typename Func, typename... BoundArgs, typename std::enable_if<std::is_base_of<Signal, SignalType>::value>::type*>
+    unsigned int SignalWidgetBase::connect(SignalType& signal, Func&& handler, BoundArgs&&... args)
+    {
+        using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
+        using UnboundArgs = typename binder::Unbound;
+
+        // The values that the signal sends are known at compile time, so no types have to be checked when connecting
+        constexpr std::size_t offset = internal_signal::findParameterOffset<1, UnboundArgs, typename SignalType::Parameters>::value;
+        static_assert((offset > 0) || std::is_same<UnboundArgs, internal_signal::TypeSet<>>::value,
+                      "The parameters of the signal handler don't match the values that the signal sends");
+
+        const unsigned int id = signal.connectHandler(binder::bindAtOffset(signal.getName(), offset, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        addConnection(id, signal);
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename Receiver, typename Func, typename... BoundArgs>
+    unsigned int SignalWidgetBase::connectWeak(const std::string& signalName, const std::weak_ptr<Receiver>& receiver, Func&& handler, BoundArgs&&... args)
+    {
+        Signal& signal = getSignal(toLower(signalName));
+
+        // Member functions are called on the receiver. The raw pointer is only used while the receiver is locked.
+        auto boundHandler = internal_signal::bindWithReceiver(std::is_member_function_pointer<typename std::decay<Func>::type>{},
+                                                              signal, receiver.lock().get(), std::forward<Func>(handler), std::forward<BoundArgs>(args)...);
+
+        // The id is only known after connecting, but the handler needs it to disconnect itself once the receiver is gone
+        auto id = std::make_shared<unsigned int>(0);
+        *id = signal.connectHandler([receiver, boundHandler, id](const void* const* parameters){
+                const auto lockedReceiver = receiver.lock();
+                if (lockedReceiver)
+                    boundHandler(parameters);
+                else
+                    Signal::disconnectFromSender(parameters, *id);
+            });
+
+        addConnection(*id, signal);
+        return *id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename WidgetList, typename Func, typename... BoundArgs>
+    std::vector<unsigned int> SignalWidgetBase::connectAll(const WidgetList& widgets, const std::string& signalName, Func&& handler, BoundArgs&&... args)
+    {
+        using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
+        const std::string lowercaseName = toLower(signalName);
+
+        std::vector<unsigned int> ids;
+        ids.reserve(widgets.size());
+
+        // The values that a signal sends only depend on its type, so the handler is only bound again when the type changes
+        std::shared_ptr<const Signal::Handler> sharedHandler;
+        std::size_t boundParametersIndex = 0;
+        for (const auto& widget : widgets)
+        {
+            SignalWidgetBase& signalWidget = *widget;
+            Signal& signal = signalWidget.getSignal(lowercaseName);
+            if (!sharedHandler || (signal.getParametersIndex() != boundParametersIndex))
+            {
+                sharedHandler = std::make_shared<const Signal::Handler>(binder::bind(signal, handler, args...));
+                boundParametersIndex = signal.getParametersIndex();
+            }
+
+            const unsigned int id = signal.connectHandler(sharedHandler);
+            signalWidget.addConnection(id, signal);
+            ids.push_back(id);
+        }
+
+        return ids;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     template <typename Func, typename... BoundArgs>
     unsigned int SignalWidgetBase::connect(std::initializer_list<std::string> signalNames, Func&& handler, BoundArgs&&... args)
     {
         unsigned int lastId = 0;
         for (auto& signalName : signalNames)
-            lastId = connect(std::move(signalName), handler, args...);
+            lastId = connect(signalName, handler, args...);
 
         return lastId;
     }
@@ -39,6 +39,7 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <TGUI/Widgets/AnchorLayout.hpp>
 #include <TGUI/Widgets/BitmapButton.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Canvas.hpp>
@@ -32,6 +32,8 @@
 #include <TGUI/Vector2f.hpp>
 #include <SFML/System/String.hpp>
 #include <functional>
+#include <future>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -350,6 +352,53 @@ namespace tgui
         static const TextureLoaderFunc& getTextureLoader();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading an image on a worker thread, so that creating a texture from it later doesn't block
+        ///
+        /// @param id  Id for the the image to load (for the default loader, the id is the filename)
+        ///
+        /// Decoding the image happens in the background, creating a texture with the same id afterwards only has to upload
+        /// the image to the graphics card. A texture that is created before the image has finished loading waits for it.
+        /// @code
+        /// auto imageLoaded = tgui::Texture::loadAsync("image.png");
+        /// ...
+        /// if (imageLoaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        ///     picture->getRenderer()->setTexture("image.png");
+        /// @endcode
+        ///
+        /// This only has an effect when the default texture loader is used and the image loader can be called from any thread.
+        ///
+        /// @return Future that becomes ready when the image has been loaded, its value is a nullptr if the image couldn't be loaded
+        ///
+        /// @see TextureManager::loadImageAsync
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_future<std::shared_ptr<const sf::Image>> loadAsync(const sf::String& id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading multiple images on worker threads
+        ///
+        /// @param ids  Ids of the images to load (for the default loader, the ids are the filenames)
+        ///
+        /// @return Future that becomes ready when all images have been loaded or failed to load
+        ///
+        /// @see loadAsync(const sf::String&)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_future<void> loadAsync(const std::vector<sf::String>& ids);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases images that were loaded with loadAsync but from which no texture was created
+        ///
+        /// @param ids  Ids of the images to release (for the default loader, the ids are the filenames)
+        ///
+        /// Images that didn't start loading yet are no longer loaded. Images that are used by textures are not affected.
+        ///
+        /// @see TextureManager::releaseAsyncImage
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseAsync(const std::vector<sf::String>& ids);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -29,7 +29,10 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <atomic>
+#include <future>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -79,10 +82,74 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading an image on a worker thread
+        ///
+        /// @param filename  Filename of the image to load
+        ///
+        /// The image is loaded with the image loader of the Texture class, which thus has to be safe to call from another thread.
+        /// When a texture is later created from the same file, getTexture uses the loaded image instead of loading it again,
+        /// so only the upload to the graphics card still happens on the thread that creates the texture. If the image hasn't
+        /// finished loading by then, getTexture waits for it.
+        ///
+        /// The loaded image is kept until all textures created from it have been destroyed, or until releaseAsyncImage is
+        /// called when no texture was created from it. This function should be called from the thread that creates the textures.
+        ///
+        /// @return Future that becomes ready when the image has been loaded, its value is a nullptr if the image couldn't be loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_future<std::shared_ptr<const sf::Image>> loadImageAsync(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading multiple images on worker threads
+        ///
+        /// @param filenames  Filenames of the images to load
+        ///
+        /// @return Future that becomes ready when all images have been loaded or failed to load
+        ///
+        /// @see loadImageAsync
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_future<void> loadImagesAsync(const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases an image that was loaded with loadImageAsync if no texture has been created from it
+        ///
+        /// @param filename  Filename of the image to release
+        ///
+        /// If the image didn't start loading yet then it is no longer loaded and its future will hold a nullptr.
+        /// The image is only destroyed once the futures of the image are no longer being used.
+        /// Images that are used by textures are kept until the textures are destroyed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseAsyncImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases all images that were loaded with loadImageAsync from which no texture has been created
+        ///
+        /// @see releaseAsyncImage
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseAsyncImages();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct AsyncImageListeners;
+
+        struct AsyncImage
+        {
+            std::shared_future<std::shared_ptr<const sf::Image>> image;
+            std::shared_ptr<std::atomic<bool>> cancelled; // Set when the image was released before it started loading
+            std::shared_ptr<AsyncImageListeners> listeners; // Functions that are called by the worker thread once the image is loaded
+        };
+
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static std::map<std::string, AsyncImage> m_asyncImages;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +46,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <unordered_set>
+#include <array>
 
 #ifdef TGUI_USE_CPP17
     #include <any>
@@ -145,6 +146,8 @@ namespace tgui
         ///
         /// @see move, getPosition
         ///
+        /// @throw Exception when the position would depend on itself. The widget keeps its previous position in this case.
+        ///
         /// Usage examples:
         /// @code
         /// // Place the widget on an exact position
@@ -194,6 +197,8 @@ namespace tgui
         ///
         /// @param size  Size of the widget
         ///
+        /// @throw Exception when the size would depend on itself. The widget keeps its previous size in this case.
+        ///
         /// Usage examples:
         /// @code
         /// // Give the widget an exact size
@@ -640,6 +645,27 @@ namespace tgui
         void unbindSizeLayout(Layout* layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how many times the layout of the given property changed the widget since the statistics were last reset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getLayoutEvaluationCount(LayoutGraph::Property property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long it took to process the last change of the layout of the given property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getLastLayoutEvaluationTime(LayoutGraph::Property property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Resets the amount of layout evaluations that were counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetLayoutStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -698,15 +724,32 @@ namespace tgui
         ///
         /// @throw Exception when the name does not match any signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal& getSignal(const std::string& signalName) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void rendererChanged(const std::string& property);
+        virtual void rendererChanged(PropertyId property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the geometry of the widget after a renderer property changed that affects it
+        ///
+        /// While setRenderer is applying the properties of a new renderer, the update is postponed until all properties have
+        /// been applied, so that the geometry is only recalculated once instead of once for every property that affects it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestGeometryUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the geometry of the widget from the cached renderer properties
+        ///
+        /// The default implementation calls setSize with the current size of the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateGeometry();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -757,8 +800,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
+        // for each changed property. Geometry updates are postponed until all properties have been handled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChangedCallback(const std::vector<PropertyId>& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const std::string& property);
+        // Callback function which is called when the value of the layout of the given property changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void layoutValueChanged(LayoutGraph::Property property);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -790,6 +840,14 @@ namespace tgui
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
 
+        // How many times the layouts changed the widget and how long the last change took, indexed by LayoutGraph::Property
+        struct LayoutStatistics
+        {
+            unsigned int evaluations = 0;
+            sf::Time lastEvaluationTime;
+        };
+        std::array<LayoutStatistics, 4> m_layoutStatistics;
+
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
 
@@ -833,13 +891,17 @@ namespace tgui
         float m_opacityCached = 1;
         bool m_transparentTextureCached = false;
 
+        // Is setRenderer applying all properties of a new renderer and was a geometry update requested while it did?
+        bool m_applyingRenderer = false;
+        bool m_geometryUpdatePending = false;
+
     #ifdef TGUI_USE_CPP17
         std::any m_userData;
     #else
         tgui::Any m_userData;
     #endif
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        std::function<void(const std::vector<PropertyId>& properties)> m_rendererChangedCallback = [this](const std::vector<PropertyId>& properties){ rendererChangedCallback(properties); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,423 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ANCHOR_LAYOUT_HPP
+#define TGUI_ANCHOR_LAYOUT_HPP
+
+
+#include <TGUI/Widgets/Group.hpp>
+#include <map>
+#include <set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Container that positions and sizes its children by anchoring their edges to the edges of other children or
+    ///        to the edges of the layout itself
+    ///
+    /// Unlike layouts that bind to other widgets, the anchors of all children are resolved together in a single pass each time
+    /// the layout or one of its children changes, in an order where every widget is placed after the widgets it is anchored to.
+    ///
+    /// Usage example:
+    /// @code
+    /// auto layout = tgui::AnchorLayout::create();
+    /// layout->add(okButton);
+    /// layout->add(cancelButton);
+    ///
+    /// // Place the cancel button 10 pixels from the bottom right corner of the layout
+    /// layout->setAnchor(cancelButton, tgui::AnchorLayout::Edge::Right, tgui::AnchorLayout::Edge::Right, 10);
+    /// layout->setAnchor(cancelButton, tgui::AnchorLayout::Edge::Bottom, tgui::AnchorLayout::Edge::Bottom, 10);
+    ///
+    /// // Place the ok button left of the cancel button
+    /// layout->setAnchor(okButton, tgui::AnchorLayout::Edge::Right, cancelButton, tgui::AnchorLayout::Edge::Left, 10);
+    /// layout->setAnchor(okButton, tgui::AnchorLayout::Edge::Top, cancelButton, tgui::AnchorLayout::Edge::Top);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API AnchorLayout : public Group
+    {
+    public:
+
+        typedef std::shared_ptr<AnchorLayout> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const AnchorLayout> ConstPtr; ///< Shared constant widget pointer
+
+
+        /// @brief Edges of a widget that can be anchored
+        enum class Edge
+        {
+            Left,             ///< Left side of the widget
+            Top,              ///< Top side of the widget
+            Right,            ///< Right side of the widget
+            Bottom,           ///< Bottom side of the widget
+            HorizontalCenter, ///< Vertical line through the middle of the widget
+            VerticalCenter    ///< Horizontal line through the middle of the widget
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @param size  Size of the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnchorLayout(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnchorLayout(const AnchorLayout& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnchorLayout(AnchorLayout&& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnchorLayout& operator= (const AnchorLayout& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnchorLayout& operator= (AnchorLayout&& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new anchor layout
+        ///
+        /// @param size  Size of the layout
+        ///
+        /// @return The new anchor layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static AnchorLayout::Ptr create(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another anchor layout
+        ///
+        /// @param layout  The other layout
+        ///
+        /// @return The new layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static AnchorLayout::Ptr copy(AnchorLayout::ConstPtr layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the layout
+        ///
+        /// @param size  The new size of the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(const Layout2d& size) override;
+        using Widget::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget to the container
+        ///
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// The widget keeps its position and size until anchors are set for it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void add(const Widget::Ptr& widget, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param widget  Pointer to the widget to remove
+        ///
+        /// @return True if widget is removed, false if widget was not found
+        ///
+        /// Anchors of other widgets that refer to the removed widget are removed as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(const Widget::Ptr& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Anchors an edge of a widget to an edge of another widget in the layout
+        ///
+        /// @param widget      Widget of which the edge should be anchored, it has to be added to the layout first
+        /// @param edge        Edge of the widget to anchor
+        /// @param target      Widget to which the edge is anchored, it has to be added to the layout as well
+        /// @param targetEdge  Edge of the target widget to which the edge is anchored
+        /// @param margin      Distance between both edges
+        ///
+        /// Left, Right and HorizontalCenter can only be anchored to each other, the same goes for Top, Bottom and VerticalCenter.
+        /// The margin moves Left, Top and the center edges to the right or down and it moves Right and Bottom to the left or up.
+        ///
+        /// When two edges of the same direction are anchored, the widget is stretched between them. Otherwise the widget keeps
+        /// its own size in that direction.
+        ///
+        /// @throw Exception when one of the widgets isn't part of the layout, when the edges are in a different direction or
+        ///                  when the target would directly or indirectly be anchored to the widget itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAnchor(const Widget::Ptr& widget, Edge edge, const Widget::Ptr& target, Edge targetEdge, float margin = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Anchors an edge of a widget to an edge of the layout
+        ///
+        /// @param widget      Widget of which the edge should be anchored, it has to be added to the layout first
+        /// @param edge        Edge of the widget to anchor
+        /// @param layoutEdge  Edge of the layout to which the edge is anchored
+        /// @param margin      Distance between both edges
+        ///
+        /// @throw Exception when the widget isn't part of the layout or when the edges are in a different direction
+        ///
+        /// @see setAnchor(const Widget::Ptr&, Edge, const Widget::Ptr&, Edge, float)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAnchor(const Widget::Ptr& widget, Edge edge, Edge layoutEdge, float margin = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the anchor from an edge of a widget
+        ///
+        /// @param widget  Widget of which the edge was anchored
+        /// @param edge    Edge that should no longer be anchored
+        ///
+        /// The widget keeps its current position and size in the direction that is no longer fully anchored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAnchor(const Widget::Ptr& widget, Edge edge);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an edge of a widget is anchored
+        ///
+        /// @param widget  Widget of which the edge may be anchored
+        /// @param edge    Edge of the widget
+        ///
+        /// @return Is the edge anchored?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAnchored(const Widget::Ptr& widget, Edge edge) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the minimum size of a widget in the layout
+        ///
+        /// @param widget       Widget of which the size should be limited
+        /// @param minimumSize  The widget will never be made smaller than this size by the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMinimumSize(const Widget::Ptr& widget, Vector2f minimumSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the minimum size of a widget in the layout
+        ///
+        /// @param widget  Widget of which the size is limited
+        ///
+        /// @return Minimum size of the widget, which is (0,0) by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getMinimumSize(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum size of a widget in the layout
+        ///
+        /// @param widget       Widget of which the size should be limited
+        /// @param maximumSize  The widget will never be made larger than this size by the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumSize(const Widget::Ptr& widget, Vector2f maximumSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum size of a widget in the layout
+        ///
+        /// @param widget  Widget of which the size is limited
+        ///
+        /// @return Maximum size of the widget, which is the highest possible float value by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getMaximumSize(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forces the widget to keep a certain ratio between its width and height
+        ///
+        /// @param widget       Widget of which the aspect ratio should be fixed
+        /// @param aspectRatio  Width divided by height, or 0 to no longer fix the aspect ratio
+        ///
+        /// When both the width and height are stretched by anchors, the widget is made as large as possible while fitting
+        /// between the anchors. Otherwise the size that isn't stretched is calculated from the other one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAspectRatio(const Widget::Ptr& widget, float aspectRatio);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the ratio between the width and height that is forced on the widget
+        ///
+        /// @param widget  Widget of which the aspect ratio may be fixed
+        ///
+        /// @return Width divided by height, or 0 when the aspect ratio isn't fixed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAspectRatio(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions and sizes all anchored widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<AnchorLayout>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // An edge of a widget is placed relative to an edge of another widget, or to the layout itself when target is a nullptr
+        struct Anchor
+        {
+            const Widget* target = nullptr;
+            Edge targetEdge = Edge::Left;
+            float margin = 0;
+        };
+
+        // Everything that determines the position and size of a child widget
+        struct Constraints
+        {
+            std::map<Edge, Anchor> anchors;
+            Vector2f minimumSize;
+            Vector2f maximumSize;
+            float aspectRatio = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the constraints of the widget, creating them if they didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Constraints& getConstraints(const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Anchors the edge of a widget to the edge of a target widget, or to the edge of the layout when target is a nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addAnchor(const Widget::Ptr& widget, Edge edge, const Widget* target, Edge targetEdge, float margin);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the constraints of a widget when they no longer differ from the defaults
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeUnusedConstraints(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the order in which the widgets have to be placed. Returns false when the anchors contain a cycle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateSolveOrder();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of an edge of a child widget, or of the layout when widget is a nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getEdgePosition(const Widget* widget, Edge edge) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions and sizes a single widget based on its constraints
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void solveWidget(Widget& widget, const Constraints& constraints);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the constraints from another layout, which contains the original widgets of which this layout contains copies
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyConstraints(const AnchorLayout& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Listens to changes of the children, so that the widgets anchored to them can be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectChild(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a child was moved or resized by someone other than the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops listening to changes of the children
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectChildren();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::map<const Widget*, Constraints> m_constraints;
+
+        // Widgets that have constraints, sorted so that every widget comes after the widgets it is anchored to
+        std::vector<std::pair<Widget*, const Constraints*>> m_solveOrder;
+        bool m_solveOrderOutdated = false;
+
+        // Widgets to which other widgets are anchored
+        std::set<const Widget*> m_anchorTargets;
+
+        // Ids of the SizeChanged and PositionChanged callbacks that were connected to the children
+        std::map<const Widget*, std::pair<unsigned int, unsigned int>> m_childCallbackIds;
+
+        // Set while the layout is moving and resizing its children, so that it ignores the changes that it made itself
+        bool m_updatingWidgets = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ANCHOR_LAYOUT_HPP
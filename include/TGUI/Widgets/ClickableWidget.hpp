@@ -112,7 +112,7 @@ namespace tgui
         ///
         /// @throw Exception when the name does not match any signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal& getSignal(const std::string& signalName) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
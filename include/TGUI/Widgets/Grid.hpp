@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -178,6 +179,9 @@ namespace tgui
         /// @param padding   Distance from the grid cell to the widget (left, top, right, bottom)
         /// @param alignment Where the widget is located in the cell
         ///
+        /// If the widget was already located in another cell of the grid then it is moved to the new cell.
+        /// A widget that was previously located in the given cell remains in the container but is no longer part of the grid.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addWidget(const Widget::Ptr& widget,
                        std::size_t        row,
@@ -296,11 +300,83 @@ namespace tgui
         Alignment getWidgetAlignment(std::size_t row, std::size_t column) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows and columns that a given widget occupies
+        ///
+        /// @param widget      The widget for which the span should be changed
+        /// @param rowSpan     Amount of rows that the cell of the widget covers, starting at the row of the widget
+        /// @param columnSpan  Amount of columns that the cell of the widget covers, starting at the column of the widget
+        ///
+        /// A widget only occupies a single cell by default. When the widget spans multiple rows or columns, the rows and
+        /// columns are only made larger when the widget wouldn't fit in their combined size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetSpan(const Widget::Ptr& widget, std::size_t rowSpan, std::size_t columnSpan);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows and columns that the widget in a certain cell occupies
+        ///
+        /// @param row         The row that the widget is in
+        /// @param column      The column that the widget is in
+        /// @param rowSpan     Amount of rows that the cell of the widget covers, starting at the row of the widget
+        /// @param columnSpan  Amount of columns that the cell of the widget covers, starting at the column of the widget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetSpan(std::size_t row, std::size_t column, std::size_t rowSpan, std::size_t columnSpan);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows and columns that a given widget occupies
+        ///
+        /// @param widget  The widget to get the span from
+        ///
+        /// @return The row span as first element and the column span as second element of the pair, or (1, 1) when the
+        ///         widget wasn't part of the grid
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<std::size_t, std::size_t> getWidgetSpan(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows and columns that the widget in a specific cell occupies
+        ///
+        /// @param row     The row that the widget is in
+        /// @param column  The column that the widget is in
+        ///
+        /// @return The row span as first element and the column span as second element of the pair, or (1, 1) when the
+        ///         cell doesn't contain a widget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<std::size_t, std::size_t> getWidgetSpan(std::size_t row, std::size_t column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows in the grid
+        ///
+        /// @return Index of the last used row plus one
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of columns in the grid
+        ///
+        /// @return Index of the last used column plus one
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getColumnCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the widgets and their positions in the grid
         ///
         /// @return grid of widgets
         ///
+        /// The grid only stores the cells that contain a widget, so the returned table is constructed when calling this function
+        /// after the grid has changed. A widget spanning multiple cells is only found in the cell where it was added.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<std::vector<Widget::Ptr>>& getGridWidgets() const;
 
@@ -352,7 +428,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position and size of the widget
+        // Recalculates the sizes of all cells and then updates the position and size of the grid and all its widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets();
 
@@ -366,19 +442,139 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Information about a cell that contains a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Cell
+        {
+            Widget::Ptr  widget;
+            Padding      padding;
+            Alignment    alignment = Alignment::Center;
+            std::size_t  rowSpan = 1;
+            std::size_t  columnSpan = 1;
+            Vector2f     extent;     // Size of the widget plus its padding, as last taken into account in the row and column sizes
+            unsigned int sizeChangedCallbackId = 0;
+        };
+
+        using CellIndex = std::pair<std::size_t, std::size_t>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places a widget in a cell and connects to its size change. Layouts aren't updated by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertCell(const CellIndex& index, Cell cell);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a cell and disconnects from its widget. Layouts aren't updated by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseCell(std::map<CellIndex, Cell>::iterator cellIt);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the extent of a cell from the row and column in which it is located. Adding recalculates the extent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addCellExtent(const CellIndex& index, Cell& cell);
+        void removeCellExtent(const CellIndex& index, const Cell& cell);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all cells and disconnects from their widgets. The widgets remain part of the container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllCells();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of rows and columns to the amount that is needed to fit all cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeToUsedCells();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the row heights and column widths based on the cached extents of the cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowAndColumnSizes();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the layout after a single cell was changed. Only the widgets that are affected by the change are moved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCell(const CellIndex& index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the size of one of the widgets in the grid changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetSizeChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets that lie in or after the given row or column
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePositionsOfWidgets(std::size_t firstRow, std::size_t firstColumn);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves a single widget to the correct location in its cell
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCellPosition(const CellIndex& index, const Cell& cell);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the extra space that is added between the cells when the grid is larger than its minimum size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getExtraOffset() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the cell in which the widget is located, or m_cells.end() when the widget isn't part of the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<CellIndex, Cell>::const_iterator findCell(const Widget* widget) const;
+        std::map<CellIndex, Cell>::iterator findCell(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the cells from another grid, which must contain copies of the same widgets in the same order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyCells(const Grid& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reconnects the size change callbacks after the cells were moved from another grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reconnectCells();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_autoSize = true;
 
-        std::vector<std::vector<Widget::Ptr>> m_gridWidgets;
-        std::vector<std::vector<Padding>>     m_objPadding;
-        std::vector<std::vector<Alignment>>   m_objAlignment;
-
         std::vector<float> m_rowHeight;
         std::vector<float> m_columnWidth;
 
-        std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
+    private:
+
+        // Only the cells that contain a widget are stored, indexed on their (row, column) location
+        std::map<CellIndex, Cell> m_cells;
+        std::map<const Widget*, CellIndex> m_widgetCells;
+        std::set<CellIndex> m_spanningCells;
+
+        // Extents of the cells that don't span multiple rows or columns, from which the row and column sizes are derived
+        std::vector<std::multiset<float>> m_rowExtents;
+        std::vector<std::multiset<float>> m_columnExtents;
+
+        // Distance from the top of the grid to each row and from the left side to each column, without the extra offset
+        std::vector<float> m_rowOffsets;
+        std::vector<float> m_columnOffsets;
+
+        Vector2f m_extraOffset;
+
+        mutable std::vector<std::vector<Widget::Ptr>> m_gridWidgets;
+        mutable bool m_gridWidgetsOutdated = false;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
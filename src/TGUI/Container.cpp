@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 
@@ -62,7 +63,9 @@ namespace tgui
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+
+            // The properties are saved by name, in alphabetical order
+            for (const auto& pair : renderer->getAllProperties())
             {
                 // Skip "font = null"
                 if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
@@ -115,12 +118,14 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_delegatedHandlers   {std::move(other.m_delegatedHandlers)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_delegatedHandlers = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,6 +137,8 @@ namespace tgui
             if (widget->getParent() == this)
                 widget->setParent(nullptr);
         }
+
+        Signal::m_delegatedHandlerCount -= static_cast<unsigned int>(m_delegatedHandlers.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +153,9 @@ namespace tgui
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = nullptr;
 
+            // Delegated handlers are not copied, just like the signal handlers
+            disconnectAllDelegated();
+
             // Remove all the old widgets
             Container::removeAllWidgets();
 
@@ -174,10 +184,14 @@ namespace tgui
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
 
+            disconnectAllDelegated();
+            m_delegatedHandlers = std::move(right.m_delegatedHandlers);
+
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_delegatedHandlers = {};
         }
 
         return *this;
@@ -246,6 +260,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int Container::connectDelegated(const std::string& signalName, const Signal::DelegateEx& handler)
+    {
+        const unsigned int id = Signal::generateConnectionId();
+        m_delegatedHandlers.push_back({id, toLower(signalName), std::make_shared<const Signal::DelegateEx>(handler)});
+        Signal::m_delegatedHandlerCount++;
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::disconnectDelegated(unsigned int id)
+    {
+        const auto it = std::find_if(m_delegatedHandlers.begin(), m_delegatedHandlers.end(),
+                                     [id](const DelegatedHandler& delegatedHandler){ return delegatedHandler.id == id; });
+        if (it == m_delegatedHandlers.end())
+            return false;
+
+        m_delegatedHandlers.erase(it);
+        Signal::m_delegatedHandlerCount--;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::disconnectAllDelegated()
+    {
+        Signal::m_delegatedHandlerCount -= static_cast<unsigned int>(m_delegatedHandlers.size());
+        m_delegatedHandlers.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -737,16 +783,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const std::string& property)
+    void Container::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (property == PropertyId::Opacity)
         {
             for (std::size_t i = 0; i < m_widgets.size(); ++i)
                 m_widgets[i]->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             for (const auto& widget : m_widgets)
             {
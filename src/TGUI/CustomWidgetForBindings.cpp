@@ -200,9 +200,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CustomWidgetForBindings::rendererChanged(const std::string& property)
+    void CustomWidgetForBindings::rendererChanged(PropertyId property)
     {
-        if (!implRendererChanged(property))
+        if (!implRendererChanged(getPropertyName(property)))
             Widget::rendererChanged(property);
     }
 
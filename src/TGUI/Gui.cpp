@@ -29,6 +29,7 @@
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
+#include <unordered_set>
 #include <cassert>
 
 #ifdef SFML_SYSTEM_WINDOWS
@@ -90,6 +91,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Gui::~Gui()
+    {
+        PostedTask* node = m_postedTasks.exchange(nullptr);
+        while (node)
+        {
+            PostedTask* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
     void Gui::setTarget(sf::RenderWindow& window)
     {
@@ -130,11 +144,10 @@ namespace tgui
         {
             m_view = view;
 
-            m_container->m_size = view.getSize();
-            m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
-
-            for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+            // The widgets are updated later when the resize policy allows postponing it
+            m_resizePending = true;
+            if (m_resizePolicy == ResizePolicy::Immediate)
+                applyPendingResize();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -149,10 +162,116 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setResizePolicy(ResizePolicy policy)
+    {
+        m_resizePolicy = policy;
+
+        if (m_resizePolicy == ResizePolicy::Immediate)
+            applyPendingResize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Gui::ResizePolicy Gui::getResizePolicy() const
+    {
+        return m_resizePolicy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setResizeThrottleInterval(sf::Time interval)
+    {
+        m_resizeThrottleInterval = interval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getResizeThrottleInterval() const
+    {
+        return m_resizeThrottleInterval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::applyPendingResize()
+    {
+        if (!m_resizePending)
+            return;
+
+        m_resizePending = false;
+        m_timeSinceResize = sf::Time::Zero;
+
+        m_container->m_size = m_view.getSize();
+        m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
+
+        for (auto& layout : m_container->m_boundSizeLayouts)
+            layout->recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> task)
+    {
+        pushPostedTask(std::move(task), false, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::postCoalesced(std::size_t id, std::function<void()> task)
+    {
+        pushPostedTask(std::move(task), true, id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::runPostedTasks()
+    {
+        // Take the entire list at once, so that the producers can keep pushing to an empty list without ever conflicting with us
+        PostedTask* node = m_postedTasks.exchange(nullptr, std::memory_order_acquire);
+        if (node)
+        {
+            // The list starts with the task that was posted last
+            std::vector<std::unique_ptr<PostedTask>> tasks;
+            while (node)
+            {
+                tasks.emplace_back(node);
+                node = node->next;
+            }
+
+            // Only the newest task of each id is executed when multiple coalesced tasks were posted with the same id
+            std::unordered_set<std::size_t> coalescedIds;
+            for (auto& task : tasks)
+            {
+                if (task->coalesced && !coalescedIds.insert(task->id).second)
+                    task->task = nullptr;
+            }
+
+            for (auto it = tasks.rbegin(); it != tasks.rend(); ++it)
+            {
+                if ((*it)->task)
+                    m_pendingPostedTasks.push(std::move((*it)->task));
+            }
+        }
+
+        // Every task is removed from the queue before it is executed, so that the tasks behind it are kept when it throws.
+        // They will then be executed the next time this function is called.
+        while (!m_pendingPostedTasks.empty())
+        {
+            const auto task = std::move(m_pendingPostedTasks.front());
+            m_pendingPostedTasks.pop();
+            task();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::handleEvent(sf::Event event)
     {
         assert(m_target != nullptr);
 
+        // Execute the functions that other threads posted, the gui might not be drawn while only events are being handled
+        runPostedTasks();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -276,11 +395,21 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // Execute the functions that other threads posted since the last frame
+        runPostedTasks();
+
         // Update the time
+        const sf::Time elapsedTime = m_clock.restart();
         if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+            updateTime(elapsedTime);
+
+        // Apply the last view size if updating the widgets was postponed
+        m_timeSinceResize += elapsedTime;
+        if (m_resizePending && ((m_resizePolicy != ResizePolicy::Throttle) || (m_timeSinceResize >= m_resizeThrottleInterval)))
+            applyPendingResize();
+
+        // Call the signal handlers of signals that were queued since the last frame
+        Signal::dispatchQueuedEmits(m_container.get());
 
         // Change the view
         const sf::View oldView = m_target->getView();
@@ -450,6 +579,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    LayoutGraph Gui::getLayoutGraph(bool resetStatistics)
+    {
+        LayoutGraph graph{*m_container};
+
+        if (resetStatistics)
+        {
+            std::vector<Widget*> widgetsToVisit{m_container.get()};
+            while (!widgetsToVisit.empty())
+            {
+                Widget* widget = widgetsToVisit.back();
+                widgetsToVisit.pop_back();
+
+                widget->resetLayoutStatistics();
+
+                auto* container = dynamic_cast<Container*>(widget);
+                if (container)
+                {
+                    for (const auto& child : container->getWidgets())
+                        widgetsToVisit.push_back(child.get());
+                }
+            }
+        }
+
+        return graph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SignalProfile Gui::getSignalProfile(bool resetStatistics)
+    {
+        return SignalProfile{*m_container, resetStatistics};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererStatistics Gui::getRendererStatistics() const
+    {
+        return RendererStatistics{*m_container};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_container->m_animationTimeElapsed = elapsedTime;
@@ -477,6 +648,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::pushPostedTask(std::function<void()>&& task, bool coalesced, std::size_t id)
+    {
+        auto node = new PostedTask{std::move(task), coalesced, id, m_postedTasks.load(std::memory_order_relaxed)};
+        while (!m_postedTasks.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+            // Another thread changed the front of the list, node->next was updated to point to the new front
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -28,12 +28,246 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <cassert>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        LayoutGraph::Property getBoundProperty(Layout::Operation operation)
+        {
+            switch (operation)
+            {
+            case Layout::Operation::BindingLeft:
+                return LayoutGraph::Property::Left;
+            case Layout::Operation::BindingTop:
+                return LayoutGraph::Property::Top;
+            case Layout::Operation::BindingWidth:
+            case Layout::Operation::BindingInnerWidth:
+                return LayoutGraph::Property::Width;
+            default: // BindingHeight or BindingInnerHeight
+                return LayoutGraph::Property::Height;
+            };
+        }
+
+        const Layout& getWidgetLayout(const Widget* widget, LayoutGraph::Property property)
+        {
+            switch (property)
+            {
+            case LayoutGraph::Property::Left:
+                return widget->getPositionLayout().x;
+            case LayoutGraph::Property::Top:
+                return widget->getPositionLayout().y;
+            case LayoutGraph::Property::Width:
+                return widget->getSizeLayout().x;
+            default: // Height
+                return widget->getSizeLayout().y;
+            };
+        }
+
+        std::string escapeDotString(const std::string& str)
+        {
+            std::string result;
+            for (const char c : str)
+            {
+                if ((c == '"') || (c == '\\'))
+                    result.push_back('\\');
+
+                result.push_back(c);
+            }
+
+            return result;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    LayoutGraph::LayoutGraph(const Widget& root)
+    {
+        std::map<std::pair<const Widget*, Property>, std::size_t> nodeIndices;
+        const auto getNodeIndex = [this,&nodeIndices](const Widget* widget, Property property)
+            {
+                const auto it = nodeIndices.find({widget, property});
+                if (it != nodeIndices.end())
+                    return it->second;
+
+                const Layout& layout = getWidgetLayout(widget, property);
+
+                Node node;
+                node.widget = widget;
+                node.widgetName = getWidgetDescription(widget);
+                node.property = property;
+                node.expression = layout.toString();
+                node.value = layout.getValue();
+                node.evaluations = widget->getLayoutEvaluationCount(property);
+                node.lastEvaluationTime = widget->getLastLayoutEvaluationTime(property);
+                nodes.push_back(std::move(node));
+
+                nodeIndices[{widget, property}] = nodes.size() - 1;
+                return nodes.size() - 1;
+            };
+
+        // Find the dependencies of the layouts of all widgets
+        std::vector<const Widget*> widgetsToVisit{&root};
+        std::vector<std::vector<std::size_t>> nodeDependencies;
+        while (!widgetsToVisit.empty())
+        {
+            const Widget* widget = widgetsToVisit.back();
+            widgetsToVisit.pop_back();
+
+            for (const auto property : {Property::Left, Property::Top, Property::Width, Property::Height})
+            {
+                std::vector<std::pair<const Widget*, Property>> dependencies;
+                getWidgetLayout(widget, property).getDependencies(dependencies);
+                if (dependencies.empty())
+                    continue;
+
+                const std::size_t dependent = getNodeIndex(widget, property);
+                for (const auto& dependency : dependencies)
+                {
+                    const std::size_t dependencyIndex = getNodeIndex(dependency.first, dependency.second);
+                    if (nodeDependencies.size() < nodes.size())
+                        nodeDependencies.resize(nodes.size());
+
+                    // The same property can be used multiple times in a layout, but it only needs a single edge
+                    auto& dependenciesOfNode = nodeDependencies[dependent];
+                    if (std::find(dependenciesOfNode.begin(), dependenciesOfNode.end(), dependencyIndex) == dependenciesOfNode.end())
+                    {
+                        dependenciesOfNode.push_back(dependencyIndex);
+                        edges.push_back({dependencyIndex, dependent});
+                    }
+                }
+            }
+
+            const auto* container = dynamic_cast<const Container*>(widget);
+            if (container)
+            {
+                for (const auto& child : container->getWidgets())
+                    widgetsToVisit.push_back(child.get());
+            }
+        }
+
+        // Calculate the depth of the nodes. Cycles are refused when binding layouts, but the visited flags make sure
+        // that this code can't get stuck in an infinite loop anyway.
+        nodeDependencies.resize(nodes.size());
+        std::vector<bool> depthCalculated(nodes.size(), false);
+        std::vector<bool> visited(nodes.size(), false);
+        const std::function<std::size_t(std::size_t)> calculateDepth = [&](std::size_t index)
+            {
+                if (depthCalculated[index] || visited[index])
+                    return nodes[index].depth;
+
+                visited[index] = true;
+
+                std::size_t depth = 0;
+                for (const auto dependency : nodeDependencies[index])
+                    depth = std::max(depth, calculateDepth(dependency) + 1);
+
+                nodes[index].depth = depth;
+                depthCalculated[index] = true;
+                return depth;
+            };
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            calculateDepth(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t LayoutGraph::getDepth() const
+    {
+        std::size_t depth = 0;
+        for (const auto& node : nodes)
+            depth = std::max(depth, node.depth);
+
+        return depth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string LayoutGraph::toDot() const
+    {
+        std::string dot = "digraph layouts {\n";
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            const Node& node = nodes[i];
+            std::string label = node.widgetName + "." + getPropertyName(node.property);
+            if (!node.expression.empty())
+                label += " = " + node.expression;
+
+            // Graphviz interprets "\n" inside the label as a line break
+            label = escapeDotString(label) + "\\n" + to_string(node.evaluations) + " evaluations, last took "
+                  + to_string(node.lastEvaluationTime.asMicroseconds()) + " us";
+
+            dot += "    n" + to_string(i) + " [label=\"" + label + "\"];\n";
+        }
+
+        for (const auto& edge : edges)
+            dot += "    n" + to_string(edge.dependency) + " -> n" + to_string(edge.dependent) + ";\n";
+
+        dot += "}\n";
+        return dot;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string LayoutGraph::getWidgetDescription(const Widget* widget)
+    {
+        const Container* parent = widget->getParent();
+        if (parent)
+        {
+            const auto& widgets = parent->getWidgets();
+            const auto& widgetNames = parent->getWidgetNames();
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                if ((widgets[i].get() == widget) && !widgetNames[i].isEmpty())
+                    return widgetNames[i];
+            }
+        }
+
+        return widget->getWidgetType();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string LayoutGraph::getPropertyName(Property property)
+    {
+        switch (property)
+        {
+        case Property::Left:
+            return "left";
+        case Property::Top:
+            return "top";
+        case Property::Width:
+            return "width";
+        default: // Height
+            return "height";
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Layout::Expression
+    {
+        struct Node
+        {
+            Operation operation; // Value, one of the math operations or BindingString when the node is a binding
+            float value; // The constant in case the operation is Value
+            std::size_t bindingIndex; // Index in the bindings of the layout in case the node is a binding
+            std::size_t leftOperand; // Index of the left operand in case the operation is a math operation
+            std::size_t rightOperand; // Index of the right operand in case the operation is a math operation
+        };
+
+        std::vector<Node> nodes; // Operands are always stored before the operations that use them, so the last node is the root
+        std::vector<std::string> boundStrings; // String of each binding, or an empty string when the binding was made to a widget directly
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(std::string expression)
@@ -53,10 +287,7 @@ namespace tgui
             {
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
-                {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
-                }
+                    initBindingString("&.innersize");
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
@@ -86,8 +317,7 @@ namespace tgui
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    initBindingString(expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
@@ -229,83 +459,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    Layout::Layout(Operation operation, Widget* boundWidget)
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
-
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
-        resetPointers();
-        recalculateValue();
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
+
+        auto expression = std::make_shared<Expression>();
+        expression->nodes.push_back({Operation::BindingString, 0, 0, 0, 0});
+        expression->boundStrings.emplace_back();
+        m_expression = std::move(expression);
+
+        Binding binding;
+        binding.operation = operation;
+        binding.widget = boundWidget;
+        updateBindingValue(binding);
+        m_bindings.push_back(binding);
+
+        m_value = binding.value;
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand)
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
-        resetPointers();
-        recalculateValue();
+        assert((operation == Operation::Plus) || (operation == Operation::Minus)
+               || (operation == Operation::Multiplies) || (operation == Operation::Divides));
+        assert(leftOperand != nullptr);
+        assert(rightOperand != nullptr);
+
+        auto expression = std::make_shared<Expression>();
+        const std::size_t leftIndex = appendOperand(*expression, *leftOperand);
+        const std::size_t rightIndex = appendOperand(*expression, *rightOperand);
+        expression->nodes.push_back({operation, 0, 0, leftIndex, rightIndex});
+        m_expression = std::move(expression);
+
+        m_value = evaluate(m_expression->nodes.size() - 1);
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
+        m_value     {other.m_value},
+        m_expression{other.m_expression},
+        m_bindings  {other.m_bindings}
     {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
-        resetPointers();
+        resetStringBindings();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+        m_value     {other.m_value},
+        m_expression{std::move(other.m_expression)}
     {
-        resetPointers();
+        // The bound widgets have to inform this layout about changes instead of the other one
+        other.unbindLayout();
+        m_bindings = std::move(other.m_bindings);
+        other.m_bindings.clear();
+
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,19 +533,13 @@ namespace tgui
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
+            m_value      = other.m_value;
+            m_expression = other.m_expression;
+            m_bindings   = other.m_bindings;
+            m_connectedWidgetCallback = nullptr;
 
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
-
-            resetPointers();
+            resetStringBindings();
+            bindLayout();
         }
 
         return *this;
@@ -341,16 +552,15 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
+            m_value      = other.m_value;
+            m_expression = std::move(other.m_expression);
+            m_bindings   = std::move(other.m_bindings);
+            m_connectedWidgetCallback = nullptr;
+            other.m_bindings.clear();
 
-            resetPointers();
+            bindLayout();
         }
 
         return *this;
@@ -367,93 +577,99 @@ namespace tgui
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (!m_expression)
             return to_string(m_value);
-        }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
-        {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
 
-            if ((m_leftOperand->m_leftOperand) && (m_rightOperand->m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (m_leftOperand->m_leftOperand)
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (m_rightOperand->m_leftOperand)
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else
-                return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
-        }
-        else
-        {
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
-        }
+        return nodeToString(m_expression->nodes.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
     {
-        if (m_boundWidget)
+        const float oldValue = m_value;
+
+        // The callback is only missing when the layout was assigned a new value since it was last connected
+        const bool newLayout = (m_connectedWidgetCallback == nullptr);
+
+        // No callbacks must be made while parsing, a single callback will be made when done if needed
+        m_connectedWidgetCallback = nullptr;
+
+        const bool bindingsChanged = parseBindingStrings(widget, xAxis);
+
+        // Only when the bindings changed can the layout have become dependent on itself
+        if (newLayout || bindingsChanged)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            for (const auto property : {LayoutGraph::Property::Left, LayoutGraph::Property::Top, LayoutGraph::Property::Width, LayoutGraph::Property::Height})
+            {
+                if (&getWidgetLayout(widget, property) != this)
+                    continue;
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
-            else
-                m_boundWidget->unbindSizeLayout(this);
+                std::set<const Layout*> visitedLayouts;
+                std::vector<std::pair<const Widget*, LayoutGraph::Property>> path;
+                if (findDependency(this, visitedLayouts, path))
+                {
+                    std::string cycle = LayoutGraph::getWidgetDescription(widget) + "." + LayoutGraph::getPropertyName(property);
+                    for (const auto& dependency : path)
+                        cycle += " -> " + LayoutGraph::getWidgetDescription(dependency.first) + "." + LayoutGraph::getPropertyName(dependency.second);
+
+                    // Break the cycle, the widget keeps the value that it had before the binding was made
+                    *this = Layout{oldValue};
+                    m_connectedWidgetCallback = valueChangedCallbackHandler;
+
+                    throw Exception{"Layout would depend on itself: " + cycle};
+                }
+
+                break;
+            }
+        }
+
+        // Restore the callback function
+        m_connectedWidgetCallback = valueChangedCallbackHandler;
+
+        if (m_value != oldValue)
+        {
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::unbindWidget(Widget* widget)
     {
-        if (m_leftOperand != nullptr)
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            assert(m_rightOperand != nullptr);
+            Binding& binding = m_bindings[i];
+            if (binding.widget != widget)
+                continue;
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
-        }
+            binding.widget = nullptr;
 
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            // A binding that was made without a string can never be restored, so it becomes a constant
+            if (!m_expression->boundStrings[i].empty())
+                binding.operation = Operation::BindingString;
             else
-                m_boundWidget->bindSizeLayout(this);
+            {
+                binding.operation = Operation::Value;
+                binding.value = 0;
+            }
         }
+
+        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    void Layout::recalculateValue()
     {
         const float oldValue = m_value;
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
-
-        parseBindingStringRecursive(widget, xAxis);
+        for (auto& binding : m_bindings)
+            updateBindingValue(binding);
 
-        // Restore the callback function
-        m_connectedWidgetCallback = valueChangedCallbackHandler;
+        if (m_expression)
+            m_value = evaluate(m_expression->nodes.size() - 1);
 
         if (m_value != oldValue)
         {
@@ -464,162 +680,181 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::getDependencies(std::vector<std::pair<const Widget*, LayoutGraph::Property>>& dependencies) const
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        for (const auto& binding : m_bindings)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            if (binding.widget)
+                dependencies.emplace_back(binding.widget, getBoundProperty(binding.operation));
         }
+    }
 
-        recalculateValue();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::initBindingString(std::string boundString)
+    {
+        auto expression = std::make_shared<Expression>();
+        expression->nodes.push_back({Operation::BindingString, 0, 0, 0, 0});
+        expression->boundStrings.push_back(std::move(boundString));
+        m_expression = std::move(expression);
+
+        m_bindings.assign(1, Binding{});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::recalculateValue()
+    std::size_t Layout::appendOperand(Expression& expression, const Layout& operand)
     {
-        const float oldValue = m_value;
+        // A constant doesn't have an expression of its own
+        if (!operand.m_expression)
+        {
+            expression.nodes.push_back({Operation::Value, operand.m_value, 0, 0, 0});
+            return expression.nodes.size() - 1;
+        }
 
-        switch (m_operation)
+        const std::size_t nodeOffset = expression.nodes.size();
+        const std::size_t bindingOffset = m_bindings.size();
+        for (auto node : operand.m_expression->nodes)
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
-            }
-            case Operation::BindingInnerHeight:
+            if (node.operation == Operation::BindingString)
+                node.bindingIndex += bindingOffset;
+            else if (node.operation != Operation::Value)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
+                node.leftOperand += nodeOffset;
+                node.rightOperand += nodeOffset;
             }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
 
-        if (m_value != oldValue)
+            expression.nodes.push_back(node);
+        }
+
+        expression.boundStrings.insert(expression.boundStrings.end(), operand.m_expression->boundStrings.begin(), operand.m_expression->boundStrings.end());
+        m_bindings.insert(m_bindings.end(), operand.m_bindings.begin(), operand.m_bindings.end());
+        return expression.nodes.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::resetStringBindings()
+    {
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            if (!m_expression->boundStrings[i].empty())
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                m_bindings[i].operation = Operation::BindingString;
+                m_bindings[i].widget = nullptr;
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    void Layout::unbindLayout()
     {
-        if (m_leftOperand)
+        for (const auto& binding : m_bindings)
         {
-            assert(m_rightOperand != nullptr);
+            if (!binding.widget)
+                continue;
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->unbindPositionLayout(this);
+            else
+                binding.widget->unbindSizeLayout(this);
         }
-
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    void Layout::bindLayout()
     {
-        if (expression == "x" || expression == "left")
+        for (const auto& binding : m_bindings)
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            if (!binding.widget)
+                continue;
+
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->bindPositionLayout(this);
+            else
+                binding.widget->bindSizeLayout(this);
         }
-        else if (expression == "y" || expression == "top")
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::parseBindingStrings(Widget* widget, bool xAxis)
+    {
+        bool bindingsChanged = false;
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
+            const std::string& boundString = m_expression->boundStrings[i];
+            if (boundString.empty())
+                continue;
+
+            Operation operation;
+            Widget* boundWidget;
+            if (!parseBindingString(boundString, widget, xAxis, operation, boundWidget))
+                continue;
+
+            // Nothing has to be done when the same widget is still bound
+            if ((m_bindings[i].operation == operation) && (m_bindings[i].widget == boundWidget))
+                continue;
+
+            // Stop listening to changes of the previously bound widgets
+            if (!bindingsChanged)
+            {
+                unbindLayout();
+                bindingsChanged = true;
+            }
+
+            m_bindings[i].operation = operation;
+            m_bindings[i].widget = boundWidget;
         }
-        else if (expression == "w" || expression == "width")
+
+        if (bindingsChanged)
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            bindLayout();
+            recalculateValue();
         }
+
+        return bindingsChanged;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Operation& boundOperation, Widget*& boundWidget)
+    {
+        if (expression == "x" || expression == "left")
+            boundOperation = Operation::BindingLeft;
+        else if (expression == "y" || expression == "top")
+            boundOperation = Operation::BindingTop;
+        else if (expression == "w" || expression == "width")
+            boundOperation = Operation::BindingWidth;
         else if (expression == "h" || expression == "height")
-        {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
-        }
+            boundOperation = Operation::BindingHeight;
         else if (expression == "iw" || expression == "innerwidth")
-        {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
-        }
+            boundOperation = Operation::BindingInnerWidth;
         else if (expression == "ih" || expression == "innerheight")
-        {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
-        }
+            boundOperation = Operation::BindingInnerHeight;
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString("width", widget, xAxis, boundOperation, boundWidget);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString("height", widget, xAxis, boundOperation, boundWidget);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString("innerwidth", widget, xAxis, boundOperation, boundWidget);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString("innerheight", widget, xAxis, boundOperation, boundWidget);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString("x", widget, xAxis, boundOperation, boundWidget);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString("y", widget, xAxis, boundOperation, boundWidget);
         }
         else
         {
@@ -630,7 +865,7 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis, boundOperation, boundWidget);
                 }
                 else if (!widgetName.empty())
                 {
@@ -643,7 +878,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, boundOperation, boundWidget);
                         }
                     }
 
@@ -655,20 +890,157 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, boundOperation, boundWidget);
                         }
                     }
                 }
             }
 
             // The referred widget was not found or there was something wrong with the string
+            return false;
+        }
+
+        boundWidget = widget;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::updateBindingValue(Binding& binding)
+    {
+        if (!binding.widget)
             return;
+
+        switch (binding.operation)
+        {
+            case Operation::BindingLeft:
+                binding.value = binding.widget->getPosition().x;
+                break;
+            case Operation::BindingTop:
+                binding.value = binding.widget->getPosition().y;
+                break;
+            case Operation::BindingWidth:
+                binding.value = binding.widget->getSize().x;
+                break;
+            case Operation::BindingHeight:
+                binding.value = binding.widget->getSize().y;
+                break;
+            case Operation::BindingInnerWidth:
+            {
+                const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                if (boundContainer)
+                    binding.value = boundContainer->getInnerSize().x;
+                break;
+            }
+            case Operation::BindingInnerHeight:
+            {
+                const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                if (boundContainer)
+                    binding.value = boundContainer->getInnerSize().y;
+                break;
+            }
+            default: // Bindings with a widget always have one of the above operations
+                break;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Layout::evaluate(std::size_t nodeIndex) const
+    {
+        const auto& node = m_expression->nodes[nodeIndex];
+        switch (node.operation)
+        {
+            case Operation::Value:
+                return node.value;
+            case Operation::Plus:
+                return evaluate(node.leftOperand) + evaluate(node.rightOperand);
+            case Operation::Minus:
+                return evaluate(node.leftOperand) - evaluate(node.rightOperand);
+            case Operation::Multiplies:
+                return evaluate(node.leftOperand) * evaluate(node.rightOperand);
+            case Operation::Divides:
+            {
+                const float divisor = evaluate(node.rightOperand);
+                if (divisor != 0)
+                    return evaluate(node.leftOperand) / divisor;
+                else
+                    return 0;
+            }
+            default: // Binding
+                return m_bindings[node.bindingIndex].value;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Layout::nodeToString(std::size_t nodeIndex) const
+    {
+        const auto& node = m_expression->nodes[nodeIndex];
+        if (node.operation == Operation::Value)
+        {
+            return to_string(node.value);
         }
+        else if ((node.operation == Operation::Plus) || (node.operation == Operation::Minus) || (node.operation == Operation::Multiplies) || (node.operation == Operation::Divides))
+        {
+            char operatorChar;
+            if (node.operation == Operation::Plus)
+                operatorChar = '+';
+            else if (node.operation == Operation::Minus)
+                operatorChar = '-';
+            else if (node.operation == Operation::Multiplies)
+                operatorChar = '*';
+            else // if (node.operation == Operation::Divides)
+                operatorChar = '/';
 
-        resetPointers();
-        recalculateValue();
+            const auto isOperation = [this](std::size_t index){
+                    return (m_expression->nodes[index].operation != Operation::Value) && (m_expression->nodes[index].operation != Operation::BindingString);
+                };
+
+            if (isOperation(node.leftOperand) && isOperation(node.rightOperand))
+                return "(" + nodeToString(node.leftOperand) + ") " + operatorChar + " (" + nodeToString(node.rightOperand) + ")";
+            else if (isOperation(node.leftOperand))
+                return "(" + nodeToString(node.leftOperand) + ") " + operatorChar + " " + nodeToString(node.rightOperand);
+            else if (isOperation(node.rightOperand))
+                return nodeToString(node.leftOperand) + " " + operatorChar + " (" + nodeToString(node.rightOperand) + ")";
+            else
+                return nodeToString(node.leftOperand) + " " + operatorChar + " " + nodeToString(node.rightOperand);
+        }
+        else
+        {
+            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+            return m_expression->boundStrings[node.bindingIndex];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::findDependency(const Layout* layout, std::set<const Layout*>& visitedLayouts,
+                                std::vector<std::pair<const Widget*, LayoutGraph::Property>>& path) const
+    {
+        for (const auto& binding : m_bindings)
+        {
+            if (!binding.widget)
+                continue;
+
+            const LayoutGraph::Property property = getBoundProperty(binding.operation);
+            const Layout* boundLayout = &getWidgetLayout(binding.widget, property);
+
+            path.emplace_back(binding.widget, property);
+            if (boundLayout == layout)
+                return true;
+
+            if (visitedLayouts.insert(boundLayout).second && boundLayout->findDependency(layout, visitedLayouts, path))
+                return true;
+
+            path.pop_back();
+        }
+
+        return false;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
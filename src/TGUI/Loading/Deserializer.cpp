@@ -388,17 +388,8 @@ namespace tgui
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
                 node = std::move(node->children[0]);
 
-            auto rendererData = RendererData::create();
-            for (const auto& pair : node->propertyValuePairs)
-                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
-
-            for (const auto& child : node->children)
-            {
-                std::stringstream ss2;
-                DataIO::emit(child, ss2);
-                rendererData->propertyValuePairs[toLower(child->name)] = {sf::String{"{\n" + ss2.str() + "}"}};
-            }
-
+            auto rendererData = RendererData::createFromDataIONode(node.get());
+            rendererData->shared = true;
             return rendererData;
         }
 
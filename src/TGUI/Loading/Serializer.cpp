@@ -208,7 +208,7 @@ namespace tgui
         std::string serializeRendererData(ObjectConverter&& value)
         {
             auto node = std::make_unique<DataIO::Node>();
-            for (const auto& pair : value.getRenderer()->propertyValuePairs)
+            for (const auto& pair : value.getRenderer()->getAllProperties())
             {
                 sf::String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
@@ -27,12 +27,119 @@
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <set>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef SFML_SYSTEM_LINUX
+    #define TGUI_THEME_USE_INOTIFY
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     namespace
     {
+        // Finds the ids of the textures in the theme without loading them (the id is the filename in quotes in front of
+        // the optional Part and Middle rectangles, like the texture deserializer would load it)
+        void findTextureIds(std::map<std::string, ObjectConverter> properties, std::set<sf::String>& textureIds)
+        {
+            for (auto& pair : properties)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                {
+                    findTextureIds(pair.second.getRenderer()->getAllProperties(), textureIds);
+                    continue;
+                }
+
+                if ((pair.second.getType() != ObjectConverter::Type::String) || (pair.first.compare(0, 7, "texture") != 0))
+                    continue;
+
+                const std::string value = pair.second.getString();
+                if (value.empty() || (toLower(value) == "none"))
+                    continue;
+
+                if (value[0] != '"')
+                {
+                #ifdef SFML_SYSTEM_WINDOWS
+                    if ((value[0] != '/') && (value[0] != '\\') && ((value.size() <= 1) || (value[1] != ':')))
+                #else
+                    if (value[0] != '/')
+                #endif
+                        textureIds.insert(getResourcePath() + value);
+                    else
+                        textureIds.insert(value);
+
+                    continue;
+                }
+
+                std::string filename;
+                char prev = '\0';
+                for (auto c = value.begin() + 1; c != value.end(); ++c)
+                {
+                    if ((*c == '"') && (prev != '\\'))
+                    {
+                        textureIds.insert(filename);
+                        break;
+                    }
+
+                    prev = *c;
+                    filename.push_back(*c);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether a property still has the same value after loading the theme again. Values that come from the theme
+        // file are compared on their text, so that a value that a widget already converted isn't seen as a changed value.
+        bool isSameValue(ObjectConverter oldValue, ObjectConverter newValue)
+        {
+            if ((oldValue.getType() == ObjectConverter::Type::RendererData) && (newValue.getType() == ObjectConverter::Type::RendererData))
+            {
+                const auto oldProperties = oldValue.getRenderer()->getAllProperties();
+                const auto newProperties = newValue.getRenderer()->getAllProperties();
+                return (oldProperties.size() == newProperties.size())
+                    && std::equal(oldProperties.begin(), oldProperties.end(), newProperties.begin(),
+                                  [](const std::pair<const std::string, ObjectConverter>& left, const std::pair<const std::string, ObjectConverter>& right)
+                                  { return (left.first == right.first) && isSameValue(left.second, right.second); });
+            }
+
+            if ((oldValue.getType() == ObjectConverter::Type::String) || (newValue.getType() == ObjectConverter::Type::String))
+                return oldValue.getString() == newValue.getString();
+            else
+                return oldValue == newValue;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates the textures of a renderer when loading the theme. The loader only caches their text, the images are owned by
+        // the renderers of the theme. Textures that fail to load are kept as text, the error is reported when a widget uses them.
+        void createTextures(PropertyTable& properties)
+        {
+            for (auto& pair : properties)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    createTextures(pair.second.getRenderer()->propertyValuePairs);
+                else if ((pair.second.getType() == ObjectConverter::Type::String) && (getPropertyName(pair.first).compare(0, 7, "texture") == 0))
+                {
+                    try
+                    {
+                        pair.second.getTexture();
+                    }
+                    catch (const Exception&)
+                    {
+                    }
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         struct DefaultTheme : public Theme
         {
             DefaultTheme()
@@ -245,6 +352,118 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    class Theme::FileWatcher
+    {
+    public:
+
+        FileWatcher(const std::string& filename) :
+            m_filename{filename}
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+        #else
+            if (filename[0] != '/')
+        #endif
+                m_fullFilename = getResourcePath() + filename;
+            else
+                m_fullFilename = filename;
+
+        #ifdef TGUI_THEME_USE_INOTIFY
+            // The directory is watched instead of the file itself, because editors often replace the file when saving it
+            const auto slashPos = m_fullFilename.rfind('/');
+            const std::string directory = (slashPos != std::string::npos) ? m_fullFilename.substr(0, slashPos + 1) : "./";
+            m_name = (slashPos != std::string::npos) ? m_fullFilename.substr(slashPos + 1) : m_fullFilename;
+
+            m_inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (m_inotifyDescriptor >= 0)
+            {
+                if (inotify_add_watch(m_inotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) >= 0)
+                    return;
+
+                close(m_inotifyDescriptor);
+                m_inotifyDescriptor = -1;
+            }
+        #endif
+
+            // Fall back to polling the modification time of the file
+            m_fileState = getFileState();
+        }
+
+        ~FileWatcher()
+        {
+        #ifdef TGUI_THEME_USE_INOTIFY
+            if (m_inotifyDescriptor >= 0)
+                close(m_inotifyDescriptor);
+        #endif
+        }
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // Returns true once after every time the file was modified
+        bool hasChanged()
+        {
+        #ifdef TGUI_THEME_USE_INOTIFY
+            if (m_inotifyDescriptor >= 0)
+            {
+                bool changed = false;
+                alignas(inotify_event) char buffer[4096];
+                ssize_t length;
+                while ((length = read(m_inotifyDescriptor, buffer, sizeof(buffer))) > 0)
+                {
+                    for (const char* ptr = buffer; ptr < buffer + length;)
+                    {
+                        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                        if ((event->len > 0) && (m_name == event->name))
+                            changed = true;
+
+                        ptr += sizeof(inotify_event) + event->len;
+                    }
+                }
+
+                return changed;
+            }
+        #endif
+
+            const auto fileState = getFileState();
+            if (fileState == m_fileState)
+                return false;
+
+            m_fileState = fileState;
+            return true;
+        }
+
+        const std::string& getFilename() const
+        {
+            return m_filename;
+        }
+
+    private:
+
+        // Returns the modification time and size of the file, which are both 0 when the file doesn't exist
+        std::pair<time_t, off_t> getFileState() const
+        {
+            struct stat fileInfo;
+            if (stat(m_fullFilename.c_str(), &fileInfo) != 0)
+                return {0, 0};
+
+            return {fileInfo.st_mtime, fileInfo.st_size};
+        }
+
+    private:
+
+        std::string m_filename;     // The filename as passed to the theme loader
+        std::string m_fullFilename; // The filename including the resource path
+        std::pair<time_t, off_t> m_fileState;
+
+    #ifdef TGUI_THEME_USE_INOTIFY
+        std::string m_name; // The filename without the directory, as reported in the inotify events
+        int m_inotifyDescriptor = -1;
+    #endif
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Theme* Theme::m_defaultTheme = &defaultTheme;
     std::shared_ptr<BaseThemeLoader> Theme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
 
@@ -267,69 +486,144 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Theme::Theme(const Theme& other) :
+        m_renderers       {other.m_renderers},
+        m_primary         {other.m_primary},
+        m_hotReloadEnabled{other.m_hotReloadEnabled},
+        m_fileWatcher     {other.m_fileWatcher ? std::make_unique<FileWatcher>(other.m_fileWatcher->getFilename()) : nullptr},
+        m_asyncTextureIds {other.m_asyncTextureIds}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Theme::Theme(Theme&&) = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Theme& Theme::operator=(const Theme& other)
+    {
+        if (this != &other)
+        {
+            Theme temp(other);
+            std::swap(m_renderers,        temp.m_renderers);
+            std::swap(m_primary,          temp.m_primary);
+            std::swap(m_hotReloadEnabled, temp.m_hotReloadEnabled);
+            std::swap(m_fileWatcher,      temp.m_fileWatcher);
+            std::swap(m_asyncTextureIds,  temp.m_asyncTextureIds);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Theme& Theme::operator=(Theme&&) = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> Theme::loadAsync(const std::string& primary)
+    {
+        m_themeLoader->preload(primary);
+
+        std::set<sf::String> textureIds;
+        for (const auto& pair : m_renderers)
+        {
+            if (m_themeLoader->canLoad(primary, pair.first))
+                findTextureIds(m_themeLoader->loadProperties(primary, pair.first), textureIds);
+        }
+
+        m_asyncTextureIds.insert(m_asyncTextureIds.end(), textureIds.begin(), textureIds.end());
+        return Texture::loadAsync(std::vector<sf::String>{textureIds.begin(), textureIds.end()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::setHotReloadEnabled(bool enabled)
+    {
+        m_hotReloadEnabled = enabled;
+
+        if (enabled && !m_primary.empty())
+            m_fileWatcher = std::make_unique<FileWatcher>(m_primary);
+        else
+            m_fileWatcher = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Theme::isHotReloadEnabled() const
+    {
+        return m_hotReloadEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Theme::reloadIfChanged()
+    {
+        if (!m_fileWatcher || !m_fileWatcher->hasChanged())
+            return false;
+
+        // Only the cache of the modified file has to be thrown away, other themes remain cached
+        DefaultThemeLoader::flushCache(m_primary);
+        load(m_primary);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Theme::load(const std::string& primary)
     {
-        m_primary = primary;
         m_themeLoader->preload(primary);
 
+        if (m_hotReloadEnabled && (!m_fileWatcher || (primary != m_primary)))
+            m_fileWatcher = std::make_unique<FileWatcher>(primary);
+
+        m_primary = primary;
+
         // Update the existing renderers
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
+            PropertyTable properties = m_themeLoader->loadProperties(m_primary, pair.first);
+            createTextures(properties);
+            renderer->flatten();
 
-            // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            // The widgets that use this renderer are informed about all changes at once
+            WidgetRenderer rendererUpdater{renderer};
+            rendererUpdater.beginUpdate();
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            // Only tell the widgets about properties that got a different value. Values that didn't change are kept so that
+            // they don't have to be deserialized again.
+            for (auto& property : properties)
             {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
-                    ++oldIt;
-                }
+                auto oldPropertyIt = renderer->propertyValuePairs.find(property.first);
+                if ((oldPropertyIt != renderer->propertyValuePairs.end()) && isSameValue(oldPropertyIt->second, property.second))
+                    property.second = std::move(oldPropertyIt->second);
                 else
-                {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
-                }
+                    renderer->pendingChanges.push_back(property.first);
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
 
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
+            // Properties that no longer exist in the theme are reset to their default value
+            for (const auto& property : renderer->propertyValuePairs)
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                if (properties.find(property.first) == properties.end())
+                    renderer->pendingChanges.push_back(property.first);
             }
+
+            renderer->propertyValuePairs = std::move(properties);
+
+            rendererUpdater.endUpdate();
+        }
+
+        // The widgets have created their textures by now, images that were loaded in advance but aren't used are released
+        if (!m_asyncTextureIds.empty())
+        {
+            Texture::releaseAsync(m_asyncTextureIds);
+            m_asyncTextureIds.clear();
         }
     }
 
@@ -344,12 +638,11 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[lowercaseSecondary];
+        auto renderer = RendererData::create();
+        renderer->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
+        createTextures(renderer->propertyValuePairs);
+        m_renderers[lowercaseSecondary] = renderer;
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,9 +661,8 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
+        createTextures(m_renderers[lowercaseSecondary]->propertyValuePairs);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -26,13 +26,26 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
 #include <sstream>
 #include <fstream>
 #include <set>
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD) || defined(SFML_SYSTEM_MACOS)
+    #define TGUI_THEME_LOADER_USE_MMAP
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
 #ifdef SFML_SYSTEM_ANDROID
     #include <SFML/System/NativeActivity.hpp>
     #include <android/asset_manager_jni.h>
@@ -53,6 +66,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> DefaultThemeLoader::m_renderersCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,8 +119,75 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
+        // Types of the values of the properties with a fixed id, indexed on the id
+        const ObjectConverter::Type builtinPropertyTypes[] =
+        {
+        #define TGUI_PROPERTY_ID_TYPE(ID, NAME, TYPE) ObjectConverter::Type::TYPE,
+            TGUI_PROPERTY_IDS(TGUI_PROPERTY_ID_TYPE)
+        #undef TGUI_PROPERTY_ID_TYPE
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates the value of a property from the theme. Values of the properties used by TGUI are deserialized immediately,
+        // based on the type that belongs to their id. Fonts, textures and renderers are left as text as they refer to other files
+        // or sections, and so are the values of unknown properties. The text of the value is kept, values that fail to deserialize
+        // are kept as text so that the error is only reported when a widget uses the value.
+        ObjectConverter createValue(const std::string& lowercaseProperty, const sf::String& value)
         {
+            ObjectConverter converter{value};
+
+            PropertyId property;
+            if (!tryGetPropertyId(lowercaseProperty, property) || (property >= PropertyId::BuiltinCount))
+                return converter;
+
+            try
+            {
+                switch (builtinPropertyTypes[static_cast<std::size_t>(property)])
+                {
+                case ObjectConverter::Type::Bool:
+                    converter.getBool();
+                    break;
+                case ObjectConverter::Type::Color:
+                    converter.getColor();
+                    break;
+                case ObjectConverter::Type::Number:
+                    converter.getNumber();
+                    break;
+                case ObjectConverter::Type::Outline:
+                    converter.getOutline();
+                    break;
+                case ObjectConverter::Type::TextStyle:
+                    converter.getTextStyle();
+                    break;
+                default:
+                    break;
+                }
+            }
+            catch (const Exception&)
+            {
+            }
+
+            return converter;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates a renderer directly from the parsed section. Nested sections and references to other sections become
+        // renderers themselves, a section that is referenced multiple times is only converted once.
+        std::shared_ptr<RendererData> createRenderer(const std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                                     std::map<const DataIO::Node*, std::shared_ptr<RendererData>>& createdRenderers,
+                                                     std::set<const DataIO::Node*>& sectionsInProgress,
+                                                     const DataIO::Node* node)
+        {
+            const auto createdIt = createdRenderers.find(node);
+            if (createdIt != createdRenderers.end())
+                return createdIt->second;
+
+            if (!sectionsInProgress.insert(node).second)
+                throw Exception{"Circular reference to section '" + node->name + "' encountered."};
+
+            auto rendererData = RendererData::create();
             for (const auto& pair : node->propertyValuePairs)
             {
                 // Check if this property is a reference to another section
@@ -118,18 +199,296 @@ namespace tgui
                     if (sectionsIt == sections.end())
                         throw Exception{"Undefined reference to '" + name + "' encountered."};
 
-                    // Resolve references recursively
-                    resolveReferences(sections, sectionsIt->second);
-
-                    // Make a copy of the section
-                    std::stringstream ss;
-                    DataIO::emit(sectionsIt->second, ss);
-                    pair.second->value = "{\n" + ss.str() + "}";
+                    rendererData->propertyValuePairs[toLower(pair.first)] = {createRenderer(sections, createdRenderers, sectionsInProgress, sectionsIt->second.get().get())};
+                }
+                else
+                {
+                    const std::string lowercaseProperty = toLower(pair.first);
+                    rendererData->propertyValuePairs[lowercaseProperty] = createValue(lowercaseProperty, pair.second->value);
                 }
             }
 
             for (const auto& child : node->children)
-                resolveReferences(sections, child);
+                rendererData->propertyValuePairs[toLower(child->name)] = {createRenderer(sections, createdRenderers, sectionsInProgress, child.get())};
+
+            sectionsInProgress.erase(node);
+            createdRenderers[node] = rendererData;
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Copies the nested renderers, so that changing the renderers of one theme doesn't affect the cached ones
+        std::map<std::string, ObjectConverter> copyProperties(const std::map<std::string, ObjectConverter>& properties)
+        {
+            auto copiedProperties = properties;
+            for (auto& pair : copiedProperties)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    pair.second = {RendererData::create(copyProperties(pair.second.getRenderer()->getAllProperties()))};
+            }
+
+            return copiedProperties;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates the text form of a renderer from the theme, nested renderers become nested sections
+        std::unique_ptr<DataIO::Node> createNode(const std::map<std::string, ObjectConverter>& properties)
+        {
+            auto node = std::make_unique<DataIO::Node>();
+            for (const auto& pair : properties)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                {
+                    node->children.push_back(createNode(ObjectConverter{pair.second}.getRenderer()->getAllProperties()));
+                    node->children.back()->parent = node.get();
+                    node->children.back()->name = pair.first;
+                }
+                else
+                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
+            }
+
+            return node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Relative filenames are relative to the resource path
+        std::string getFullFilename(const std::string& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+        #else
+            if (filename[0] != '/')
+        #endif
+                return getResourcePath() + filename;
+            else
+                return filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Binary theme files start with a fixed header followed by the version of the format
+        const char binaryThemeHeader[8] = {'T', 'G', 'U', 'I', 'T', 'H', 'M', '\0'};
+        const std::uint32_t binaryThemeVersion = 2;
+
+        // A property in a binary theme either has a string value or refers to another section (a nested section or a reference)
+        const std::uint32_t binaryPropertyString = 0;
+        const std::uint32_t binaryPropertySection = 1;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Read-only view on the contents of a file, which is memory-mapped when the platform supports it
+        class FileContents
+        {
+        public:
+            FileContents() = default;
+            FileContents(const FileContents&) = delete;
+            FileContents& operator=(const FileContents&) = delete;
+
+            ~FileContents()
+            {
+            #ifdef TGUI_THEME_LOADER_USE_MMAP
+                if (m_mapping)
+                    munmap(m_mapping, m_size);
+            #endif
+            }
+
+            void open(const std::string& fullFilename)
+            {
+            #ifdef TGUI_THEME_LOADER_USE_MMAP
+                const int fileDescriptor = ::open(fullFilename.c_str(), O_RDONLY);
+                if (fileDescriptor >= 0)
+                {
+                    struct stat fileInfo;
+                    if ((fstat(fileDescriptor, &fileInfo) == 0) && (fileInfo.st_size > 0))
+                    {
+                        void* mapping = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                        if (mapping != MAP_FAILED)
+                        {
+                            m_mapping = mapping;
+                            m_data = static_cast<const char*>(mapping);
+                            m_size = static_cast<std::size_t>(fileInfo.st_size);
+                        }
+                    }
+
+                    ::close(fileDescriptor);
+                    if (m_mapping)
+                        return;
+                }
+            #endif
+
+                std::ifstream file{fullFilename, std::ios::binary};
+                if (!file.is_open())
+                    throw Exception{"Failed to open theme file '" + fullFilename + "'."};
+
+                setContents({std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()});
+            }
+
+            void setContents(std::string contents)
+            {
+                m_buffer = std::move(contents);
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+            }
+
+            const char* getData() const
+            {
+                return m_data;
+            }
+
+            std::size_t getSize() const
+            {
+                return m_size;
+            }
+
+        private:
+        #ifdef TGUI_THEME_LOADER_USE_MMAP
+            void* m_mapping = nullptr;
+        #endif
+            std::string m_buffer; // Only used when the file isn't memory-mapped
+            const char* m_data = nullptr;
+            std::size_t m_size = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t decodeUint32(const unsigned char* data)
+        {
+            return static_cast<std::uint32_t>(data[0])
+                 | (static_cast<std::uint32_t>(data[1]) << 8)
+                 | (static_cast<std::uint32_t>(data[2]) << 16)
+                 | (static_cast<std::uint32_t>(data[3]) << 24);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the little-endian values from a binary theme file
+        class BinaryThemeReader
+        {
+        public:
+            BinaryThemeReader(const std::string& filename, const char* data, std::size_t size) :
+                m_filename{filename},
+                m_pos     {reinterpret_cast<const unsigned char*>(data)},
+                m_end     {reinterpret_cast<const unsigned char*>(data) + size}
+            {
+            }
+
+            std::uint32_t readUint32()
+            {
+                requireBytes(4);
+                const std::uint32_t value = decodeUint32(m_pos);
+                m_pos += 4;
+                return value;
+            }
+
+            // Returns the current position and skips the given amount of bytes, so that they can be decoded later
+            const unsigned char* skipBytes(std::size_t count)
+            {
+                requireBytes(count);
+                const unsigned char* pos = m_pos;
+                m_pos += count;
+                return pos;
+            }
+
+            void requireBytes(std::size_t count) const
+            {
+                if (static_cast<std::size_t>(m_end - m_pos) < count)
+                    throwCorrupt();
+            }
+
+            void throwCorrupt() const
+            {
+                throw Exception{"Failed to load binary theme file '" + m_filename + "'. The file is corrupt."};
+            }
+
+        private:
+            const std::string& m_filename;
+            const unsigned char* m_pos;
+            const unsigned char* m_end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Binary theme of which only the location of the strings and sections was read. The strings are only decoded when
+        // the renderer of a section that uses them is created.
+        struct BinaryTheme
+        {
+            struct StringView
+            {
+                const unsigned char* data;
+                std::uint32_t size;
+            };
+
+            struct Section
+            {
+                const unsigned char* properties; // Triplets of name, kind and value for every property
+                std::uint32_t propertyCount;
+            };
+
+            FileContents file;
+            std::vector<StringView> strings;
+            std::vector<Section> sections;
+            std::map<std::string, std::uint32_t> namedSections; // Index in sections for every top-level section
+        };
+
+        std::map<std::string, std::unique_ptr<BinaryTheme>> binaryThemes;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String decodeString(const std::string& filename, const BinaryTheme& theme, std::uint32_t index)
+        {
+            if (index >= theme.strings.size())
+                throw Exception{"Failed to load binary theme file '" + filename + "'. The file is corrupt."};
+
+            const auto& view = theme.strings[index];
+            return sf::String::fromUtf8(view.data, view.data + view.size);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates the renderer of a section from a binary theme. Sections that are used multiple times are only converted once.
+        std::shared_ptr<RendererData> createBinaryRenderer(const std::string& filename, const BinaryTheme& theme, std::uint32_t sectionIndex,
+                                                     std::map<std::uint32_t, std::shared_ptr<RendererData>>& createdRenderers,
+                                                     std::set<std::uint32_t>& sectionsInProgress)
+        {
+            const auto createdIt = createdRenderers.find(sectionIndex);
+            if (createdIt != createdRenderers.end())
+                return createdIt->second;
+
+            // The compiler never creates circular references, so the file was damaged when one is found
+            if ((sectionIndex >= theme.sections.size()) || !sectionsInProgress.insert(sectionIndex).second)
+                throw Exception{"Failed to load binary theme file '" + filename + "'. The file is corrupt."};
+
+            auto rendererData = RendererData::create();
+            const auto& section = theme.sections[sectionIndex];
+            for (std::uint32_t i = 0; i < section.propertyCount; ++i)
+            {
+                const unsigned char* property = section.properties + (i * std::size_t{12});
+                const std::string name = decodeString(filename, theme, decodeUint32(property));
+                const std::uint32_t kind = decodeUint32(property + 4);
+                const std::uint32_t value = decodeUint32(property + 8);
+
+                if (kind == binaryPropertySection)
+                    rendererData->propertyValuePairs[name] = {createBinaryRenderer(filename, theme, value, createdRenderers, sectionsInProgress)};
+                else
+                    rendererData->propertyValuePairs[name] = createValue(name, decodeString(filename, theme, value));
+            }
+
+            sectionsInProgress.erase(sectionIndex);
+            createdRenderers[sectionIndex] = rendererData;
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& output, std::uint32_t value)
+        {
+            output.push_back(static_cast<char>(value & 0xFF));
+            output.push_back(static_cast<char>((value >> 8) & 0xFF));
+            output.push_back(static_cast<char>((value >> 16) & 0xFF));
+            output.push_back(static_cast<char>((value >> 24) & 0xFF));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,17 +502,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> BaseThemeLoader::loadProperties(const std::string& primary, const std::string& secondary)
+    {
+        std::map<std::string, ObjectConverter> properties;
+        for (const auto& property : load(primary, secondary))
+            properties[property.first] = ObjectConverter(property.second);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
         {
-            auto propertiesCacheIt = m_propertiesCache.find(filename);
-            if (propertiesCacheIt != m_propertiesCache.end())
-                m_propertiesCache.erase(propertiesCacheIt);
+            m_propertiesCache.erase(filename);
+            m_renderersCache.erase(filename);
+            binaryThemes.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
+            m_renderersCache.clear();
+            binaryThemes.clear();
         }
     }
 
@@ -165,7 +537,7 @@ namespace tgui
             return;
 
         // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        if (m_renderersCache.find(filename) == m_renderersCache.end())
         {
             std::string resourcePath;
             auto slashPos = filename.find_last_of("/\\");
@@ -195,24 +567,14 @@ namespace tgui
                 sections.emplace(name, std::cref(child));
             }
 
-            // Resolve references to sections
-            resolveReferences(sections, root);
-
-            // Cache all propery value pairs
+            // Create the renderers from the parsed sections. The text form of a section is only created when load is called.
+            std::map<const DataIO::Node*, std::shared_ptr<RendererData>> createdRenderers;
+            std::set<const DataIO::Node*> sectionsInProgress;
+            std::map<std::string, std::map<std::string, ObjectConverter>> renderers;
             for (const auto& section : sections)
-            {
-                const auto& child = section.second;
-                const std::string& name = section.first;
-                for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][toLower(pair.first)] = pair.second->value;
+                renderers[section.first] = createRenderer(sections, createdRenderers, sectionsInProgress, section.second.get().get())->getAllProperties();
 
-                for (const auto& nestedProperty : child.get()->children)
-                {
-                    std::stringstream ss;
-                    DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
-                }
-            }
+            m_renderersCache[filename] = std::move(renderers);
         }
     }
 
@@ -228,10 +590,52 @@ namespace tgui
         if (filename.empty())
             return m_propertiesCache[""][lowercaseClassName];
 
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
+        auto& sections = m_propertiesCache[filename];
+        const auto sectionIt = sections.find(lowercaseClassName);
+        if (sectionIt != sections.end())
+            return sectionIt->second;
+
+        // The text form of the section is created from the cached renderer the first time it is requested
+        const auto renderersCacheIt = m_renderersCache.find(filename);
+        if (renderersCacheIt == m_renderersCache.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        const auto rendererIt = renderersCacheIt->second.find(lowercaseClassName);
+        if (rendererIt == renderersCacheIt->second.end())
             throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
 
-        return m_propertiesCache[filename][lowercaseClassName];
+        auto& properties = sections[lowercaseClassName];
+        for (const auto& pair : rendererIt->second)
+        {
+            if (pair.second.getType() == ObjectConverter::Type::RendererData)
+            {
+                std::stringstream ss;
+                DataIO::emit(createNode(ObjectConverter{pair.second}.getRenderer()->getAllProperties()), ss);
+                properties[pair.first] = "{\n" + ss.str() + "}";
+            }
+            else
+                properties[pair.first] = ObjectConverter{pair.second}.getString();
+        }
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> DefaultThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        const auto renderersCacheIt = m_renderersCache.find(filename);
+        if (renderersCacheIt != m_renderersCache.end())
+        {
+            const auto sectionIt = renderersCacheIt->second.find(toLower(section));
+            if (sectionIt != renderersCacheIt->second.end())
+                return copyProperties(sectionIt->second);
+        }
+
+        // Themes that weren't loaded from a text file only have the property-value pairs as strings
+        return BaseThemeLoader::loadProperties(filename, section);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,8 +644,14 @@ namespace tgui
     {
         if (filename.empty())
             return true;
-        else
-            return m_propertiesCache[filename].find(toLower(section)) != m_propertiesCache[filename].end();
+
+        const std::string lowercaseClassName = toLower(section);
+        const auto renderersCacheIt = m_renderersCache.find(filename);
+        if ((renderersCacheIt != m_renderersCache.end()) && (renderersCacheIt->second.find(lowercaseClassName) != renderersCacheIt->second.end()))
+            return true;
+
+        const auto propertiesCacheIt = m_propertiesCache.find(filename);
+        return (propertiesCacheIt != m_propertiesCache.end()) && (propertiesCacheIt->second.find(lowercaseClassName) != propertiesCacheIt->second.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,15 +661,7 @@ namespace tgui
         if (filename.empty())
             return;
 
-        std::string fullFilename;
-    #ifdef SFML_SYSTEM_WINDOWS
-        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
-    #else
-        if (filename[0] != '/')
-    #endif
-            fullFilename = getResourcePath() + filename;
-        else
-            fullFilename = filename;
+        const std::string fullFilename = getFullFilename(filename);
 
     #ifdef SFML_SYSTEM_ANDROID
         // If the file does not start with a slash then load it from the assets
@@ -307,6 +709,204 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::preload(const std::string& filename)
+    {
+        if (filename.empty() || (binaryThemes.find(filename) != binaryThemes.end()) || (m_renderersCache.find(filename) != m_renderersCache.end()))
+            return;
+
+        auto theme = std::make_unique<BinaryTheme>();
+    #ifdef SFML_SYSTEM_ANDROID
+        // The file may have to be loaded from the assets
+        std::stringstream contents;
+        readFile(filename, contents);
+        theme->file.setContents(contents.str());
+    #else
+        theme->file.open(getFullFilename(filename));
+    #endif
+
+        // Files without the binary header are loaded as text themes
+        const FileContents& file = theme->file;
+        if ((file.getSize() < sizeof(binaryThemeHeader)) || (std::memcmp(file.getData(), binaryThemeHeader, sizeof(binaryThemeHeader)) != 0))
+        {
+            DefaultThemeLoader::preload(filename);
+            return;
+        }
+
+        BinaryThemeReader reader{filename, file.getData() + sizeof(binaryThemeHeader), file.getSize() - sizeof(binaryThemeHeader)};
+
+        const std::uint32_t version = reader.readUint32();
+        if (version != binaryThemeVersion)
+            throw Exception{"Failed to load binary theme file '" + filename + "'. Version " + std::to_string(version) + " of the format is not supported."};
+
+        // Every string in the theme is stored once in the string table and referred to by its index.
+        // Only the location of the strings is stored here, they are decoded when a renderer needs them.
+        const std::uint32_t stringCount = reader.readUint32();
+        reader.requireBytes(stringCount * std::size_t{4});
+        theme->strings.reserve(stringCount);
+        for (std::uint32_t i = 0; i < stringCount; ++i)
+        {
+            const std::uint32_t length = reader.readUint32();
+            theme->strings.push_back({reader.skipBytes(length), length});
+        }
+
+        // Nested sections and sections that are referenced are stored after the top-level sections, which have a name
+        const std::uint32_t sectionCount = reader.readUint32();
+        const std::uint32_t namedSectionCount = reader.readUint32();
+        if (namedSectionCount > sectionCount)
+            reader.throwCorrupt();
+
+        reader.requireBytes(sectionCount * std::size_t{8});
+        theme->sections.reserve(sectionCount);
+        for (std::uint32_t i = 0; i < sectionCount; ++i)
+        {
+            const std::uint32_t nameIndex = reader.readUint32();
+            const std::uint32_t propertyCount = reader.readUint32();
+            theme->sections.push_back({reader.skipBytes(propertyCount * std::size_t{12}), propertyCount});
+
+            if (i < namedSectionCount)
+                theme->namedSections.emplace(decodeString(filename, *theme, nameIndex), i);
+        }
+
+        m_renderersCache[filename];
+        binaryThemes[filename] = std::move(theme);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& BinaryThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+        createSectionRenderer(filename, section);
+        return DefaultThemeLoader::load(filename, section);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BinaryThemeLoader::canLoad(const std::string& filename, const std::string& section)
+    {
+        const auto binaryThemeIt = binaryThemes.find(filename);
+        if (binaryThemeIt != binaryThemes.end())
+            return binaryThemeIt->second->namedSections.find(toLower(section)) != binaryThemeIt->second->namedSections.end();
+
+        return DefaultThemeLoader::canLoad(filename, section);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> BinaryThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+        createSectionRenderer(filename, section);
+        return DefaultThemeLoader::loadProperties(filename, section);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::createSectionRenderer(const std::string& filename, const std::string& section)
+    {
+        const auto binaryThemeIt = binaryThemes.find(filename);
+        if (binaryThemeIt == binaryThemes.end())
+            return;
+
+        const std::string lowercaseClassName = toLower(section);
+        auto& renderers = m_renderersCache[filename];
+        if (renderers.find(lowercaseClassName) != renderers.end())
+            return;
+
+        const auto& theme = *binaryThemeIt->second;
+        const auto sectionIt = theme.namedSections.find(lowercaseClassName);
+        if (sectionIt == theme.namedSections.end())
+            return; // DefaultThemeLoader will throw the exception for the missing section
+
+        std::map<std::uint32_t, std::shared_ptr<RendererData>> createdRenderers;
+        std::set<std::uint32_t> sectionsInProgress;
+        renderers[lowercaseClassName] = createBinaryRenderer(filename, theme, sectionIt->second, createdRenderers, sectionsInProgress)->getAllProperties();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::compile(const std::string& filename, const std::string& binaryFilename)
+    {
+        // Let the text loader parse the theme, inject the resource paths and resolve the references
+        DefaultThemeLoader loader;
+        loader.preload(filename);
+        const auto& renderers = m_renderersCache[filename];
+
+        std::vector<const sf::String*> strings;
+        std::map<sf::String, std::uint32_t> stringIndices;
+        const auto getStringIndex = [&](const sf::String& string) {
+            const auto it = stringIndices.find(string);
+            if (it != stringIndices.end())
+                return it->second;
+
+            const auto index = static_cast<std::uint32_t>(strings.size());
+            strings.push_back(&stringIndices.emplace(string, index).first->first);
+            return index;
+        };
+
+        // The top-level sections come first. Nested sections and referenced sections are added behind them when a property
+        // refers to them, a renderer that is used by multiple properties is only stored once.
+        // A deque is used because the properties of the current section are still accessed while sections are added.
+        std::deque<std::pair<std::string, std::map<std::string, ObjectConverter>>> sections;
+        for (const auto& renderer : renderers)
+            sections.emplace_back(renderer.first, renderer.second);
+
+        std::map<const RendererData*, std::uint32_t> nestedSectionIndices;
+        std::string sectionData;
+        for (std::size_t i = 0; i < sections.size(); ++i)
+        {
+            const auto& properties = sections[i].second;
+            writeUint32(sectionData, getStringIndex(sections[i].first));
+            writeUint32(sectionData, static_cast<std::uint32_t>(properties.size()));
+            for (const auto& pair : properties)
+            {
+                writeUint32(sectionData, getStringIndex(pair.first));
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                {
+                    const auto nestedRenderer = ObjectConverter{pair.second}.getRenderer();
+                    auto nestedIt = nestedSectionIndices.find(nestedRenderer.get());
+                    if (nestedIt == nestedSectionIndices.end())
+                    {
+                        nestedIt = nestedSectionIndices.emplace(nestedRenderer.get(), static_cast<std::uint32_t>(sections.size())).first;
+                        sections.emplace_back(pair.first, nestedRenderer->getAllProperties());
+                    }
+
+                    writeUint32(sectionData, binaryPropertySection);
+                    writeUint32(sectionData, nestedIt->second);
+                }
+                else
+                {
+                    writeUint32(sectionData, binaryPropertyString);
+                    writeUint32(sectionData, getStringIndex(ObjectConverter{pair.second}.getString()));
+                }
+            }
+        }
+
+        std::string output{binaryThemeHeader, sizeof(binaryThemeHeader)};
+        writeUint32(output, binaryThemeVersion);
+        writeUint32(output, static_cast<std::uint32_t>(strings.size()));
+        for (const sf::String* string : strings)
+        {
+            const auto utf8 = string->toUtf8();
+            writeUint32(output, static_cast<std::uint32_t>(utf8.size()));
+            output.append(utf8.begin(), utf8.end());
+        }
+
+        writeUint32(output, static_cast<std::uint32_t>(sections.size()));
+        writeUint32(output, static_cast<std::uint32_t>(renderers.size()));
+        output += sectionData;
+
+        std::ofstream file{binaryFilename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + binaryFilename + "' for saving the binary theme to it."};
+
+        file.write(output.data(), static_cast<std::streamsize>(output.size()));
+        if (!file)
+            throw Exception{"Failed to write the binary theme to '" + binaryFilename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Widgets/AnchorLayout.hpp>
 #include <TGUI/Widgets/BitmapButton.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Canvas.hpp>
@@ -62,6 +63,7 @@ namespace tgui
 {
     std::map<std::string, std::function<Widget::Ptr()>> WidgetFactory::m_constructFunctions =
     {
+        {"anchorlayout", std::make_shared<AnchorLayout>},
         {"bitmapbutton", std::make_shared<BitmapButton>},
         {"button", std::make_shared<Button>},
         {"canvas", std::make_shared<Canvas>},
@@ -38,12 +38,10 @@ namespace tgui
     {
         assert(m_type != Type::None);
 
-        if (m_serialized)
-            return m_string;
+        if (!m_serialized)
+            m_serialized = std::make_shared<Serialized>(Serializer::serialize(ObjectConverter{*this}));
 
-        m_string = Serializer::serialize(ObjectConverter{*this});
-        m_serialized = true;
-        return m_string;
+        return m_serialized->string;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,10 +52,7 @@ namespace tgui
         assert(m_type == Type::Font || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Font(m_string);
-            m_type = Type::Font;
-        }
+            deserializeAs(Type::Font);
 
     #ifdef TGUI_USE_CPP17
         return std::get<Font>(m_value);
@@ -74,10 +69,7 @@ namespace tgui
         assert(m_type == Type::Color || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Color(m_string);
-            m_type = Type::Color;
-        }
+            deserializeAs(Type::Color);
 
     #ifdef TGUI_USE_CPP17
         return std::get<Color>(m_value);
@@ -94,10 +86,7 @@ namespace tgui
         assert(m_type == Type::Bool || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Bool, m_string).getBool();
-            m_type = Type::Bool;
-        }
+            deserializeAs(Type::Bool);
 
     #ifdef TGUI_USE_CPP17
         return std::get<bool>(m_value);
@@ -114,10 +103,7 @@ namespace tgui
         assert(m_type == Type::Number || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
-            m_type = Type::Number;
-        }
+            deserializeAs(Type::Number);
 
     #ifdef TGUI_USE_CPP17
         return std::get<float>(m_value);
@@ -134,10 +120,7 @@ namespace tgui
         assert(m_type == Type::Outline || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline();
-            m_type = Type::Outline;
-        }
+            deserializeAs(Type::Outline);
 
     #ifdef TGUI_USE_CPP17
         return std::get<Outline>(m_value);
@@ -154,10 +137,20 @@ namespace tgui
         assert(m_type == Type::Texture || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture();
-            m_type = Type::Texture;
-        }
+            deserializeAs(Type::Texture);
+
+    #ifdef TGUI_USE_CPP17
+        return std::get<Texture>(m_value);
+    #else
+        return m_value.as<Texture>();
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Texture& ObjectConverter::getTexture() const
+    {
+        assert(m_type == Type::Texture);
 
     #ifdef TGUI_USE_CPP17
         return std::get<Texture>(m_value);
@@ -174,10 +167,7 @@ namespace tgui
         assert(m_type == Type::TextStyle || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle();
-            m_type = Type::TextStyle;
-        }
+            deserializeAs(Type::TextStyle);
 
     #ifdef TGUI_USE_CPP17
         return std::get<TextStyle>(m_value);
@@ -194,10 +184,7 @@ namespace tgui
         assert(m_type == Type::RendererData || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer();
-            m_type = Type::RendererData;
-        }
+            deserializeAs(Type::RendererData);
 
     #ifdef TGUI_USE_CPP17
         return std::get<std::shared_ptr<RendererData>>(m_value);
@@ -228,7 +215,7 @@ namespace tgui
         case Type::None:
             return true;
         case Type::String:
-            return m_string == right.m_string;
+            return (m_serialized == right.m_serialized) || (m_serialized->string == right.m_serialized->string);
     #ifdef TGUI_USE_CPP17
         case Type::Bool:
             return std::get<bool>(m_value) == std::get<bool>(right.m_value);
@@ -277,6 +264,39 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::deserializeAs(Type type)
+    {
+        assert(m_type == Type::String);
+        assert(m_serialized);
+
+        // Textures hold on to their image, so they aren't kept alive by the copies that only store the string
+        if (type == Type::Texture)
+        {
+            m_value = std::move(Deserializer::deserialize(type, m_serialized->string).m_value);
+            m_type = type;
+            return;
+        }
+
+        // Only the first copy that needs the value has to deserialize the string
+        Serialized& serialized = *m_serialized;
+        if (serialized.valueType != type)
+        {
+            if (type == Type::Font)
+                serialized.value = Font(serialized.string);
+            else if (type == Type::Color)
+                serialized.value = Color(serialized.string);
+            else
+                serialized.value = std::move(Deserializer::deserialize(type, serialized.string).m_value);
+
+            serialized.valueType = type;
+        }
+
+        m_value = serialized.value;
+        m_type = type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
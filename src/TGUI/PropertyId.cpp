@@ -0,0 +1,141 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PropertyId.hpp>
+#include <TGUI/Global.hpp>
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // The properties with a fixed id are never changed after construction and can be accessed without locking
+        struct BuiltinProperties
+        {
+            BuiltinProperties()
+            {
+            #define TGUI_PROPERTY_ID_NAME(ID, NAME, TYPE) names.push_back(toLower(#NAME));
+                TGUI_PROPERTY_IDS(TGUI_PROPERTY_ID_NAME)
+            #undef TGUI_PROPERTY_ID_NAME
+
+                for (std::size_t i = 0; i < names.size(); ++i)
+                    ids[names[i]] = static_cast<PropertyId>(i);
+            }
+
+            std::vector<std::string> names;
+            std::unordered_map<std::string, PropertyId> ids;
+        };
+
+        // Properties that got an id at runtime, a deque is used so that the names don't move when new ones are added
+        struct RuntimeProperties
+        {
+            std::mutex mutex;
+            std::deque<std::string> names;
+            std::unordered_map<std::string, PropertyId> ids;
+        };
+
+        const BuiltinProperties& getBuiltinProperties()
+        {
+            static const BuiltinProperties builtinProperties;
+            return builtinProperties;
+        }
+
+        RuntimeProperties& getRuntimeProperties()
+        {
+            static RuntimeProperties runtimeProperties;
+            return runtimeProperties;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId getPropertyId(const std::string& lowercaseProperty)
+    {
+        const auto& builtinProperties = getBuiltinProperties();
+        const auto builtinIt = builtinProperties.ids.find(lowercaseProperty);
+        if (builtinIt != builtinProperties.ids.end())
+            return builtinIt->second;
+
+        auto& runtimeProperties = getRuntimeProperties();
+        std::lock_guard<std::mutex> lock(runtimeProperties.mutex);
+
+        const auto it = runtimeProperties.ids.find(lowercaseProperty);
+        if (it != runtimeProperties.ids.end())
+            return it->second;
+
+        const auto id = static_cast<PropertyId>(static_cast<unsigned int>(PropertyId::BuiltinCount) + runtimeProperties.names.size());
+        runtimeProperties.names.push_back(lowercaseProperty);
+        runtimeProperties.ids[lowercaseProperty] = id;
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool tryGetPropertyId(const std::string& lowercaseProperty, PropertyId& property)
+    {
+        const auto& builtinProperties = getBuiltinProperties();
+        const auto builtinIt = builtinProperties.ids.find(lowercaseProperty);
+        if (builtinIt != builtinProperties.ids.end())
+        {
+            property = builtinIt->second;
+            return true;
+        }
+
+        auto& runtimeProperties = getRuntimeProperties();
+        std::lock_guard<std::mutex> lock(runtimeProperties.mutex);
+
+        const auto it = runtimeProperties.ids.find(lowercaseProperty);
+        if (it == runtimeProperties.ids.end())
+            return false;
+
+        property = it->second;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& getPropertyName(PropertyId property)
+    {
+        const auto index = static_cast<std::size_t>(property);
+        const auto& builtinProperties = getBuiltinProperties();
+        if (index < builtinProperties.names.size())
+            return builtinProperties.names[index];
+
+        auto& runtimeProperties = getRuntimeProperties();
+        std::lock_guard<std::mutex> lock(runtimeProperties.mutex);
+        return runtimeProperties.names.at(index - builtinProperties.names.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,191 @@
 
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
+#include <TGUI/Container.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Property sets that are used as base of copy-on-write renderers, identical sets are only stored once.
+        // The sets are indexed on a hash of their property ids and value types.
+        struct SharedProperties
+        {
+            std::mutex mutex;
+            std::unordered_map<std::size_t, std::vector<std::weak_ptr<const PropertyTable>>> buckets;
+        };
+
+        // The sets keep the registry alive, as they may still be destroyed after the static variables of this file
+        const auto sharedProperties = std::make_shared<SharedProperties>();
+
+        std::size_t hashProperties(const PropertyTable& properties)
+        {
+            std::size_t hash = properties.size();
+            for (const auto& pair : properties)
+                hash = (hash * 31) ^ ((static_cast<std::size_t>(pair.first) << 4) + static_cast<std::size_t>(pair.second.getType()));
+
+            return hash;
+        }
+
+        void removeExpiredSharedProperties(std::vector<std::weak_ptr<const PropertyTable>>& candidates)
+        {
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [](const std::weak_ptr<const PropertyTable>& candidate){ return candidate.expired(); }),
+                             candidates.end());
+        }
+
+        std::shared_ptr<const PropertyTable> getSharedProperties(const PropertyTable& properties)
+        {
+            // The candidates are only released after unlocking the mutex, as releasing the last reference locks it again
+            std::vector<std::shared_ptr<const PropertyTable>> lockedCandidates;
+            std::lock_guard<std::mutex> lock(sharedProperties->mutex);
+
+            const std::size_t hash = hashProperties(properties);
+            auto& candidates = sharedProperties->buckets[hash];
+            removeExpiredSharedProperties(candidates);
+
+            for (const auto& candidate : candidates)
+            {
+                lockedCandidates.push_back(candidate.lock());
+                if (lockedCandidates.back() && (*lockedCandidates.back() == properties))
+                    return lockedCandidates.back();
+            }
+
+            // When the last renderer stops using the set, its bucket is removed from the registry once it no longer holds any sets
+            auto registry = sharedProperties;
+            std::shared_ptr<const PropertyTable> newProperties{new PropertyTable(properties), [registry, hash](PropertyTable* expiredProperties){
+                    delete expiredProperties;
+
+                    std::lock_guard<std::mutex> deleterLock(registry->mutex);
+                    const auto it = registry->buckets.find(hash);
+                    if (it == registry->buckets.end())
+                        return;
+
+                    removeExpiredSharedProperties(it->second);
+                    if (it->second.empty())
+                        registry->buckets.erase(it);
+                }};
+
+            candidates.push_back(newProperties);
+            return newProperties;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Estimates the memory of the entries in a property table, including the text of values that are strings.
+        // The names of the properties are stored only once for all tables and are not included.
+        std::size_t estimatePropertyBytes(const PropertyTable& properties)
+        {
+            std::size_t bytes = 0;
+            for (const auto& pair : properties)
+            {
+                bytes += sizeof(pair);
+
+                if (pair.second.getType() == ObjectConverter::Type::String)
+                    bytes += ObjectConverter{pair.second}.getString().getSize() * sizeof(sf::Uint32);
+            }
+
+            return bytes;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addPropertiesToStatistics(RendererStatistics& statistics, std::unordered_set<const void*>& visited, const PropertyTable& properties);
+
+        void addRendererToStatistics(RendererStatistics& statistics, std::unordered_set<const void*>& visited, const std::shared_ptr<RendererData>& renderer)
+        {
+            if (!renderer || !visited.insert(renderer.get()).second)
+                return;
+
+            const std::size_t observerCount = renderer->observers.size() + renderer->batchObservers.size();
+            statistics.rendererCount++;
+            statistics.observerCount += observerCount;
+            statistics.bytesUsed += sizeof(RendererData) + (observerCount * (sizeof(std::pair<const void* const, std::function<void()>>) + 4 * sizeof(void*)));
+            addPropertiesToStatistics(statistics, visited, renderer->propertyValuePairs);
+
+            if (renderer->base && visited.insert(renderer->base.get()).second)
+            {
+                statistics.sharedBaseCount++;
+                statistics.bytesUsed += sizeof(PropertyTable);
+                addPropertiesToStatistics(statistics, visited, *renderer->base);
+            }
+        }
+
+        void addPropertiesToStatistics(RendererStatistics& statistics, std::unordered_set<const void*>& visited, const PropertyTable& properties)
+        {
+            statistics.propertyCount += properties.size();
+            statistics.bytesUsed += estimatePropertyBytes(properties);
+
+            for (const auto& pair : properties)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    addRendererToStatistics(statistics, visited, ObjectConverter{pair.second}.getRenderer());
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::PropertyTable(const std::map<std::string, ObjectConverter>& properties)
+    {
+        m_values.reserve(properties.size());
+        for (const auto& pair : properties)
+            m_values.emplace_back(getPropertyId(pair.first), pair.second);
+
+        std::sort(m_values.begin(), m_values.end(), [](const value_type& left, const value_type& right){ return left.first < right.first; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> PropertyTable::toMap() const
+    {
+        std::map<std::string, ObjectConverter> properties;
+        for (const auto& pair : m_values)
+            properties.emplace(getPropertyName(pair.first), pair.second);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::insert(const PropertyTable& other)
+    {
+        if (other.empty())
+            return;
+
+        // Both tables are sorted, so they can be merged without searching for every property separately
+        std::vector<value_type> values;
+        values.reserve(m_values.size() + other.m_values.size());
+
+        auto it = m_values.begin();
+        auto otherIt = other.m_values.begin();
+        while ((it != m_values.end()) && (otherIt != other.m_values.end()))
+        {
+            if (otherIt->first < it->first)
+                values.push_back(*otherIt++);
+            else
+            {
+                if (otherIt->first == it->first)
+                    ++otherIt;
+
+                values.push_back(std::move(*it++));
+            }
+        }
+
+        values.insert(values.end(), std::make_move_iterator(it), std::make_move_iterator(m_values.end()));
+        values.insert(values.end(), otherIt, other.m_values.end());
+        m_values = std::move(values);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,23 +223,24 @@ namespace tgui
         else if (opacity > 1)
             opacity = 1;
 
-        setProperty("opacity", ObjectConverter{opacity});
+        setProperty(PropertyId::Opacity, ObjectConverter{opacity});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(PropertyId::FontProperty, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        ObjectConverter temporary;
+        ObjectConverter* value = m_data->findConvertibleProperty(PropertyId::FontProperty, temporary);
+        if (value)
+            return value->getFont();
         else
             return {};
     }
@@ -68,47 +249,156 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(getPropertyId(toLower(property)), std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
+    void WidgetRenderer::setProperty(PropertyId property, ObjectConverter&& value)
+    {
+        // A copy-on-write renderer only stores the property when it gets a different value than the one in the shared base
+        if (m_data->base && (m_data->propertyValuePairs.find(property) == m_data->propertyValuePairs.end()))
         {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+            const auto baseIt = m_data->base->find(property);
+            if ((baseIt != m_data->base->end()) && (baseIt->second == value))
+                return;
+        }
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+        ObjectConverter& storedValue = m_data->propertyValuePairs[property];
+        if (storedValue != value)
+        {
+            storedValue = std::move(value);
+            propertyChanged(property);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::propertyChanged(PropertyId property)
+    {
+        if (m_data->updateDepth > 0)
+        {
+            m_data->pendingChanges.push_back(property);
+            return;
+        }
+
+        // Keep the data alive in case an observer replaces the renderer of its widget
+        const auto data = m_data;
+        for (const auto& observer : data->observers)
+            observer.second(property);
+
+        if (!data->batchObservers.empty())
+        {
+            const std::vector<PropertyId> properties{property};
+            for (const auto& observer : data->batchObservers)
+                observer.second(properties);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperties(const std::map<std::string, ObjectConverter>& properties)
+    {
+        beginUpdate();
+        try
+        {
+            for (const auto& property : properties)
+                setProperty(getPropertyId(toLower(property.first)), ObjectConverter{property.second});
+        }
+        catch (...)
+        {
+            endUpdate();
+            throw;
+        }
+
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::beginUpdate()
+    {
+        m_data->updateDepth++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::endUpdate()
+    {
+        if (m_data->updateDepth == 0)
+            return;
+
+        m_data->updateDepth--;
+        if ((m_data->updateDepth > 0) || m_data->pendingChanges.empty())
+            return;
+
+        // Every property is only reported once, even when it was changed multiple times during the update
+        std::vector<PropertyId> properties;
+        properties.swap(m_data->pendingChanges);
+        std::sort(properties.begin(), properties.end());
+        properties.erase(std::unique(properties.begin(), properties.end()), properties.end());
+
+        const auto data = m_data;
+        for (const auto& observer : data->observers)
+        {
+            for (const auto& property : properties)
+                observer.second(property);
+        }
+
+        for (const auto& observer : data->batchObservers)
+            observer.second(properties);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
-        if (it != m_data->propertyValuePairs.end())
-            return it->second;
+        // A property that never got an id can't have a value
+        PropertyId id;
+        if (tryGetPropertyId(toLower(property), id))
+            return getProperty(id);
         else
             return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    ObjectConverter WidgetRenderer::getProperty(PropertyId property) const
     {
-        return m_data->propertyValuePairs;
+        const ObjectConverter* value = m_data->findProperty(property);
+        if (value)
+            return *value;
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> WidgetRenderer::getPropertyValuePairs() const
+    {
+        return m_data->getAllProperties();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(PropertyId property)>& function)
     {
         m_data->observers[id] = function;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::subscribeBatched(const void* id, const std::function<void(const std::vector<PropertyId>& properties)>& function)
+    {
+        m_data->batchObservers[id] = function;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::unsubscribe(const void* id)
     {
         m_data->observers.erase(id);
+        m_data->batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,10 +421,72 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->batchObservers = {};
+        data->pendingChanges = {};
+        data->updateDepth = 0;
+        data->flatten();
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> WidgetRenderer::createOverlay() const
+    {
+        auto data = std::make_shared<RendererData>();
+
+        if (!m_data->base)
+            data->base = getSharedProperties(m_data->propertyValuePairs);
+        else if (m_data->propertyValuePairs.empty())
+            data->base = m_data->base;
+        else
+        {
+            // The renderer is a copy-on-write renderer itself, the new base contains both its changed and unchanged properties
+            PropertyTable properties = m_data->propertyValuePairs;
+            properties.insert(*m_data->base);
+            data->base = getSharedProperties(properties);
+        }
+
         return data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererStatistics::RendererStatistics(const Container& root)
+    {
+        std::unordered_set<const void*> visited;
+        std::unordered_set<const RendererData*> widgetRenderers;
+
+        std::vector<const Container*> containersToVisit{&root};
+        while (!containersToVisit.empty())
+        {
+            const Container* container = containersToVisit.back();
+            containersToVisit.pop_back();
+
+            for (const auto& child : container->getWidgets())
+            {
+                std::vector<const Widget*> widgets{child.get()};
+                if (child->getToolTip())
+                    widgets.push_back(child->getToolTip().get());
+
+                for (const Widget* widget : widgets)
+                {
+                    const auto renderer = widget->getSharedRenderer()->getData();
+                    widgetRenderers.insert(renderer.get());
+                    addRendererToStatistics(*this, visited, renderer);
+                    widgetCount++;
+
+                    const auto* childContainer = dynamic_cast<const Container*>(widget);
+                    if (childContainer)
+                        containersToVisit.push_back(childContainer);
+                }
+            }
+        }
+
+        if (!widgetRenderers.empty())
+            sharingRatio = static_cast<float>(widgetCount) / widgetRenderers.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,30 +25,96 @@
 
 #include <TGUI/Signal.hpp>
 #include <TGUI/Widget.hpp>
+#include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <unordered_set>
+#include <algorithm>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    unsigned int lastId = 0;
+    struct QueuedEmit
+    {
+        const tgui::Signal* signal;
+        std::weak_ptr<tgui::Widget> widget;
+        std::function<void(const tgui::Widget*)> emit;
+        bool latest; // Was the signal using QueuedLatest delivery?
+    };
 
-    unsigned int generateUniqueId()
+    // Every thread has its own queue, so that guis of different windows can run on separate threads
+    thread_local std::vector<QueuedEmit> queuedEmits;
+    thread_local std::unordered_map<const tgui::Signal*, std::size_t> latestQueuedEmits; // Index in queuedEmits for signals with QueuedLatest delivery
+
+    void dispatchEmits(const std::vector<QueuedEmit>& emits)
     {
-        return ++lastId;
+        for (const auto& queuedEmit : emits)
+        {
+            // The signal is a member of the widget, so it no longer exists when the widget was destroyed
+            const auto widget = queuedEmit.widget.lock();
+            if (widget)
+                queuedEmit.emit(widget.get());
+        }
     }
 
-    template <typename T>
-    bool checkParamType(std::initializer_list<std::type_index>::const_iterator type)
+    struct SignalStatistics
+    {
+        const tgui::Widget* widget = nullptr;
+        unsigned int emits = 0;
+        unsigned int handlerCalls = 0;
+        sf::Time handlerTime;
+    };
+
+    // Statistics of the signals that were emitted on this thread while profiling, signals remove themselves from the map when destroyed
+    thread_local std::unordered_map<const tgui::Signal*, SignalStatistics> signalStatistics;
+
+    std::string escapeCsvString(const std::string& str)
     {
-    #ifdef TGUI_UNSAFE_TYPE_INFO_COMPARISON
-        return strcmp(type->name(), typeid(T).name()) == 0;
-    #else
-        return *type == typeid(T);
-    #endif
+        if (str.find_first_of(",\"\n") == std::string::npos)
+            return str;
+
+        std::string result = "\"";
+        for (const char c : str)
+        {
+            if (c == '"')
+                result += "\"\"";
+            else
+                result += c;
+        }
+
+        return result + "\"";
+    }
+
+    std::string escapeJsonString(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                result += '\\';
+                result += c;
+            }
+            else if (c == '\n')
+                result += "\\n";
+            else if (static_cast<unsigned char>(c) < 0x20)
+                result += ' ';
+            else
+                result += c;
+        }
+
+        return result;
+    }
+
+    // Shared by all threads, so that ids stay unique when guis on different threads connect signal handlers
+    std::atomic<unsigned int> lastId{0};
+
+    unsigned int generateUniqueId()
+    {
+        return ++lastId;
     }
 }
 
@@ -56,16 +122,23 @@ namespace
 
 namespace tgui
 {
-    namespace internal_signal
+    std::atomic<bool> Signal::m_profilingEnabled{false};
+    std::atomic<unsigned int> Signal::m_delegatedHandlerCount{0};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::~Signal()
     {
-        std::deque<const void*> parameters;
+        if (!signalStatistics.empty())
+            signalStatistics.erase(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Signal::Signal(const Signal& other) :
         m_name    {other.m_name},
-        m_handlers{} // signal handlers are not copied with the widget
+        m_handlers{nullptr}, // signal handlers are not copied with the widget
+        m_delivery{other.m_delivery}
     {
     }
 
@@ -76,7 +149,8 @@ namespace tgui
         if (this != &other)
         {
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
+            m_delivery = other.m_delivery;
         }
 
         return *this;
@@ -87,7 +161,7 @@ namespace tgui
     unsigned int Signal::connect(const Delegate& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = handler;
+        addHandler(id, [handler](const void* const*){ handler(); });
         return id;
     }
 
@@ -96,7 +170,25 @@ namespace tgui
     unsigned int Signal::connect(const DelegateEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name); });
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectHandler(const Handler& handler)
+    {
+        const auto id = generateUniqueId();
+        addHandler(id, handler);
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectHandler(std::shared_ptr<const Handler> handler)
+    {
+        const auto id = generateUniqueId();
+        getWritableHandlers().emplace_back(id, std::move(handler));
         return id;
     }
 
@@ -104,197 +196,330 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (!m_handlers)
+            return false;
+
+        const auto it = std::lower_bound(m_handlers->begin(), m_handlers->end(), id,
+                                         [](const std::pair<unsigned int, std::shared_ptr<const Handler>>& handler, unsigned int handlerId){ return handler.first < handlerId; });
+        if ((it == m_handlers->end()) || (it->first != id))
+            return false;
+
+        // The iterator can't be used after the list was copied
+        const auto index = it - m_handlers->begin();
+        auto& handlers = getWritableHandlers();
+        handlers.erase(handlers.begin() + index);
+
+        if (handlers.empty())
+            m_handlers = nullptr;
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Signal::getWidget()
+    void Signal::addHandler(unsigned int id, Handler handler)
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        // Ids are handed out in increasing order, so the new handler can be added to the back of the list
+        auto& handlers = getWritableHandlers();
+        handlers.emplace_back(id, std::make_shared<const Handler>(std::move(handler)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int Signal::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    std::vector<std::pair<unsigned int, std::shared_ptr<const Signal::Handler>>>& Signal::getWritableHandlers()
     {
-        if (unboundParameters.size() == 0)
-            return 0;
-        else
-            throw Exception{"Signal '" + m_name + "' could not provide data for unbound parameters."};
+        // While the signal is being emitted, the list is shared with the emit function and the list has to be copied
+        if (!m_handlers)
+            m_handlers = std::make_shared<std::vector<std::pair<unsigned int, std::shared_ptr<const Handler>>>>();
+        else if (m_handlers.use_count() > 1)
+            m_handlers = std::make_shared<std::vector<std::pair<unsigned int, std::shared_ptr<const Handler>>>>(*m_handlers);
+
+        return *m_handlers;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#ifndef TGUI_REMOVE_DEPRECATED_CODE
-    #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
-    unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
-    { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
-    } \
-    \
-    unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
-    { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+    Widget::Ptr Signal::getWidget(const void* const* parameters)
+    {
+        return internal_signal::dereference<Widget*>(parameters[0])->shared_from_this();
     }
 
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(UInt, unsigned int)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Bool, bool)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Float, float)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(String, const sf::String&)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Vector2f, Vector2f)
-#endif
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Signal::disconnectFromSender(const void* const* parameters, unsigned int id)
+    {
+        internal_signal::dereference<Widget*>(parameters[0])->disconnect(id);
+    }
 
-    unsigned int SignalInt::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::setDelivery(Delivery delivery)
     {
-        if ((unboundParameters.size() == 1) && checkParamType<int>(unboundParameters.begin()))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        m_delivery = delivery;
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalUInt::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    Signal::Delivery Signal::getDelivery() const
     {
-        if ((unboundParameters.size() == 1) && checkParamType<unsigned int>(unboundParameters.begin()))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        return m_delivery;
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalBool::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    void Signal::dispatchQueuedEmits()
     {
-        if ((unboundParameters.size() == 1) && checkParamType<bool>(unboundParameters.begin()))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        // Emits that are queued by the signal handlers end up in the new queue
+        std::vector<QueuedEmit> emits;
+        emits.swap(queuedEmits);
+        latestQueuedEmits.clear();
+
+        dispatchEmits(emits);
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalFloat::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    void Signal::dispatchQueuedEmits(const Widget* root)
     {
-        if ((unboundParameters.size() == 1) && checkParamType<float>(unboundParameters.begin()))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        // The root is only looked up now, as the widget may have been added to a gui after emitting the signal.
+        // Emits of widgets that no longer exist are dropped, so that they don't stay in the queue when no root dispatches them.
+        std::vector<QueuedEmit> emits;
+        std::vector<QueuedEmit> remainingEmits;
+        for (auto& queuedEmit : queuedEmits)
+        {
+            const auto widget = queuedEmit.widget.lock();
+            if (!widget)
+                continue;
+
+            const Widget* widgetRoot = widget.get();
+            while (widgetRoot->getParent())
+                widgetRoot = widgetRoot->getParent();
+
+            if (widgetRoot == root)
+                emits.push_back(std::move(queuedEmit));
+            else
+                remainingEmits.push_back(std::move(queuedEmit));
+        }
+
+        // Emits that are queued by the signal handlers end up in the queue again
+        queuedEmits.swap(remainingEmits);
+
+        // The emits of other roots that remain in the queue may have moved
+        latestQueuedEmits.clear();
+        for (std::size_t i = 0; i < queuedEmits.size(); ++i)
+        {
+            if (queuedEmits[i].latest)
+                latestQueuedEmits[queuedEmits[i].signal] = i;
+        }
+
+        dispatchEmits(emits);
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalString::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    void Signal::setProfilingEnabled(bool enabled)
     {
-        if ((unboundParameters.size() == 1) && (checkParamType<std::string>(unboundParameters.begin()) || checkParamType<sf::String>(unboundParameters.begin())))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        m_profilingEnabled = enabled;
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalVector2f::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    bool Signal::isProfilingEnabled()
     {
-        if ((unboundParameters.size() == 1) && (checkParamType<Vector2f>(unboundParameters.begin()) || checkParamType<sf::Vector2f>(unboundParameters.begin())))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        return m_profilingEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#ifndef TGUI_REMOVE_DEPRECATED_CODE
-    unsigned int SignalRange::connect(const DelegateRange& handler)
+
+    void Signal::recordEmit(const Widget* widget)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        auto& statistics = signalStatistics[this];
+        statistics.widget = widget;
+        statistics.emits++;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalRange::connect(const DelegateRangeEx& handler)
+    bool Signal::callHandlersProfiled(const void* const* parameters)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        // The entry is normally created when emitting, but profiling may have been enabled after an emit was queued
+        signalStatistics[this].widget = internal_signal::dereference<const Widget*>(parameters[0]);
+
+        sf::Clock clock;
+        const auto handlers = m_handlers;
+        for (const auto& handler : *handlers)
+            (*handler.second)(parameters);
+
+        const sf::Time elapsedTime = clock.getElapsedTime();
+
+        // The entry no longer exists when a signal handler destroyed the widget (and thus this signal)
+        const auto it = signalStatistics.find(this);
+        if (it != signalStatistics.end())
+        {
+            it->second.handlerCalls += static_cast<unsigned int>(handlers->size());
+            it->second.handlerTime += elapsedTime;
+        }
+
+        return true;
     }
-#endif
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SignalRange::emit(const Widget* widget, float start, float end)
+    std::function<void()> Signal::findDelegatedHandlers(const Widget* widget) const
     {
-        if (m_handlers.empty())
-            return false;
+        if (!widget)
+            return nullptr;
+
+        std::vector<std::shared_ptr<const DelegateEx>> handlers;
+        std::string lowercaseName;
+        for (const Container* parent = widget->getParent(); parent != nullptr; parent = parent->getParent())
+        {
+            if (parent->m_delegatedHandlers.empty())
+                continue;
+
+            if (lowercaseName.empty())
+                lowercaseName = toLower(m_name);
 
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+            for (const auto& delegatedHandler : parent->m_delegatedHandlers)
+            {
+                if (delegatedHandler.lowercaseSignalName == lowercaseName)
+                    handlers.push_back(delegatedHandler.handler);
+            }
+        }
+
+        if (handlers.empty())
+            return nullptr;
+
+        // The shared pointer keeps the widget alive until all delegated handlers have been called
+        const Widget::Ptr sender = const_cast<Widget*>(widget)->shared_from_this();
+        return [sender, handlers, name=m_name]{
+                for (const auto& handler : handlers)
+                    (*handler)(sender, name);
+            };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::generateConnectionId()
+    {
+        return generateUniqueId();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalRange::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    bool Signal::queueEmit(const Widget* widget, std::function<void(const Widget*)> emit)
     {
-        if ((unboundParameters.size() == 2) && checkParamType<float>(unboundParameters.begin()) && checkParamType<float>(unboundParameters.begin()+1))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        std::weak_ptr<Widget> weakWidget;
+        try
+        {
+            weakWidget = const_cast<Widget*>(widget)->shared_from_this();
+        }
+        catch (const std::bad_weak_ptr&)
+        {
+            // Without a shared_ptr there is no way to tell whether the widget still exists later, so the emit can't be queued
+            emit(widget);
+            return true;
+        }
+
+        const bool latest = (m_delivery == Delivery::QueuedLatest);
+        if (latest)
+        {
+            const auto it = latestQueuedEmits.find(this);
+            if (it != latestQueuedEmits.end())
+            {
+                queuedEmits[it->second] = {this, std::move(weakWidget), std::move(emit), latest};
+                return true;
+            }
+
+            latestQueuedEmits[this] = queuedEmits.size();
+        }
+
+        queuedEmits.push_back({this, std::move(weakWidget), std::move(emit), latest});
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
-    unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
+    #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
+    unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
+    { \
+        const auto id = generateUniqueId(); \
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<Type>(parameters[1])); }); \
+        return id; \
+    } \
+    \
+    unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
+    { \
+        const auto id = generateUniqueId(); \
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<Type>(parameters[1])); }); \
+        return id; \
+    }
+
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(UInt, unsigned int)
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Bool, bool)
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Float, float)
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(String, const sf::String&)
+    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Vector2f, Vector2f)
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TGUI_REMOVE_DEPRECATED_CODE
+    unsigned int SignalRange::connect(const DelegateRange& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
         return id;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
+    unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
         return id;
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool SignalChildWindow::emit(ChildWindow* childWindow)
+    bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
-            return false;
+        return emitValues(widget, start, end);
+    }
 
-        ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
-        internal_signal::parameters[1] = static_cast<const void*>(&sharedPtr);
-        return Signal::emit(childWindow);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TGUI_REMOVE_DEPRECATED_CODE
+    unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
+    {
+        const auto id = generateUniqueId();
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
+        return id;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalChildWindow::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
+    {
+        const auto id = generateUniqueId();
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
+        return id;
+    }
+#endif
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if ((unboundParameters.size() == 1) && checkParamType<ChildWindow::Ptr>(unboundParameters.begin()))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        const ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
+        return emitValues(childWindow, sharedPtr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,7 +527,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -311,7 +536,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -320,7 +545,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
         return id;
     }
 
@@ -329,32 +554,16 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
         return id;
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    unsigned int SignalItem::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
-    {
-        if ((unboundParameters.size() == 1) && (checkParamType<std::string>(unboundParameters.begin()) || checkParamType<sf::String>(unboundParameters.begin())))
-            return 1;
-        else if ((unboundParameters.size() == 2)
-              && (checkParamType<std::string>(unboundParameters.begin()) || checkParamType<sf::String>(unboundParameters.begin()))
-              && (checkParamType<std::string>(unboundParameters.begin()+1) || checkParamType<sf::String>(unboundParameters.begin()+1)))
-        {
-            return 1;
-        }
-        else
-            return Signal::validateTypes(unboundParameters);
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -363,7 +572,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -372,7 +581,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFull& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
         return id;
     }
 
@@ -381,34 +590,160 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFullEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
         return id;
     }
 #endif
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScopedConnection::ScopedConnection(const std::shared_ptr<Widget>& widget, unsigned int id) :
+        m_widget{widget},
+        m_id    {id}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScopedConnection::ScopedConnection(ScopedConnection&& other) noexcept :
+        m_widget{std::move(other.m_widget)},
+        m_id    {other.m_id}
+    {
+        other.m_widget.reset();
+        other.m_id = 0;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalItemHierarchy::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    ScopedConnection& ScopedConnection::operator=(ScopedConnection&& other)
     {
-        if ((unboundParameters.size() == 1) && (checkParamType<std::string>(unboundParameters.begin()) || checkParamType<sf::String>(unboundParameters.begin())))
-            return 1;
-        if ((unboundParameters.size() == 1) && checkParamType<std::vector<sf::String>>(unboundParameters.begin()))
-            return 2;
-        else
-            return Signal::validateTypes(unboundParameters);
+        if (this != &other)
+        {
+            disconnect();
+
+            m_widget = std::move(other.m_widget);
+            m_id = other.m_id;
+
+            other.m_widget.reset();
+            other.m_id = 0;
+        }
+
+        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int SignalAnimation::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
+    ScopedConnection::~ScopedConnection()
     {
-        if ((unboundParameters.size() == 1) && checkParamType<ShowAnimationType>(unboundParameters.begin()))
-            return 1;
-        if ((unboundParameters.size() == 1) && checkParamType<bool>(unboundParameters.begin()))
-            return 2;
-        if ((unboundParameters.size() == 2) && checkParamType<ShowAnimationType>(unboundParameters.begin()) && checkParamType<bool>(unboundParameters.begin()+1))
-            return 1;
-        else
-            return Signal::validateTypes(unboundParameters);
+        disconnect();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScopedConnection::disconnect()
+    {
+        const auto widget = m_widget.lock();
+        if (widget)
+            widget->disconnect(m_id);
+
+        m_widget.reset();
+        m_id = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ScopedConnection::release()
+    {
+        const unsigned int id = m_id;
+        m_widget.reset();
+        m_id = 0;
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ScopedConnection::getId() const
+    {
+        return m_id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SignalProfile::SignalProfile(const Widget& root, bool resetStatistics)
+    {
+        std::unordered_set<const Widget*> widgets;
+        std::vector<const Widget*> widgetsToVisit{&root};
+        while (!widgetsToVisit.empty())
+        {
+            const Widget* widget = widgetsToVisit.back();
+            widgetsToVisit.pop_back();
+            widgets.insert(widget);
+
+            const auto* container = dynamic_cast<const Container*>(widget);
+            if (container)
+            {
+                for (const auto& child : container->getWidgets())
+                    widgetsToVisit.push_back(child.get());
+            }
+        }
+
+        for (auto it = signalStatistics.begin(); it != signalStatistics.end();)
+        {
+            if (widgets.find(it->second.widget) == widgets.end())
+            {
+                ++it;
+                continue;
+            }
+
+            Entry entry;
+            entry.widget = it->second.widget;
+            entry.widgetName = LayoutGraph::getWidgetDescription(entry.widget);
+            entry.signalName = it->first->getName();
+            entry.emits = it->second.emits;
+            entry.handlerCalls = it->second.handlerCalls;
+            entry.handlerTime = it->second.handlerTime;
+            entries.push_back(std::move(entry));
+
+            if (resetStatistics)
+                it = signalStatistics.erase(it);
+            else
+                ++it;
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right){ return left.handlerTime > right.handlerTime; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string SignalProfile::toCsv() const
+    {
+        std::string csv = "Widget,Signal,Emits,Handler calls,Handler time (us)\n";
+        for (const auto& entry : entries)
+        {
+            csv += escapeCsvString(entry.widgetName) + "," + escapeCsvString(entry.signalName) + "," + to_string(entry.emits) + ","
+                 + to_string(entry.handlerCalls) + "," + to_string(entry.handlerTime.asMicroseconds()) + "\n";
+        }
+
+        return csv;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string SignalProfile::toJson() const
+    {
+        std::string json = "[";
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            const Entry& entry = entries[i];
+            json += (i > 0) ? ",\n  " : "\n  ";
+            json += "{\"widget\": \"" + escapeJsonString(entry.widgetName) + "\", \"signal\": \"" + escapeJsonString(entry.signalName)
+                  + "\", \"emits\": " + to_string(entry.emits) + ", \"handlerCalls\": " + to_string(entry.handlerCalls)
+                  + ", \"handlerTimeUs\": " + to_string(entry.handlerTime.asMicroseconds()) + "}";
+        }
+
+        json += entries.empty() ? "]\n" : "\n]\n";
+        return json;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,10 +751,11 @@ namespace tgui
 
     bool SignalWidgetBase::disconnect(unsigned int id)
     {
-        auto it = m_connectedSignals.find(id);
-        if (it != m_connectedSignals.end())
+        const auto it = std::lower_bound(m_connectedSignals.begin(), m_connectedSignals.end(), id,
+                                         [](const std::pair<unsigned int, std::ptrdiff_t>& connection, unsigned int connectionId){ return connection.first < connectionId; });
+        if ((it != m_connectedSignals.end()) && (it->first == id))
         {
-            const bool ret = getSignal(it->second).disconnect(id);
+            const bool ret = getSignalAtOffset(it->second).disconnect(id);
             m_connectedSignals.erase(it);
             return ret;
         }
@@ -429,21 +765,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SignalWidgetBase::disconnectAll(std::string signalName)
+    void SignalWidgetBase::disconnectAll(const std::string& signalName)
     {
-        return getSignal(toLower(std::move(signalName))).disconnectAll();
+        return getSignal(toLower(signalName)).disconnectAll();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SignalWidgetBase::disconnectAll()
     {
-        std::set<std::string> signalNames;
+        std::set<std::ptrdiff_t> signalOffsets;
         for (const auto& connection : m_connectedSignals)
-            signalNames.insert(connection.second);
+            signalOffsets.insert(connection.second);
+
+        for (const auto offset : signalOffsets)
+            getSignalAtOffset(offset).disconnectAll();
+
+        m_connectedSignals.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        for (auto& name : signalNames)
-            getSignal(std::move(name)).disconnectAll();
+    void SignalWidgetBase::addConnection(unsigned int id, const Signal& signal)
+    {
+        // Signals are members of the widget, so their position within the widget is the same in copies of the widget
+        const std::ptrdiff_t offset = reinterpret_cast<const char*>(&signal) - reinterpret_cast<const char*>(this);
+
+        // Ids are handed out in increasing order, so the new connection normally ends up at the back of the list
+        auto it = m_connectedSignals.end();
+        while ((it != m_connectedSignals.begin()) && (std::prev(it)->first > id))
+            --it;
+
+        m_connectedSignals.emplace(it, id, offset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& SignalWidgetBase::getSignalAtOffset(std::ptrdiff_t offset)
+    {
+        return *reinterpret_cast<Signal*>(reinterpret_cast<char*>(this) + offset);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,24 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Inserts the resource path in front of the id unless it is an absolute path
+        sf::String getFilename(const sf::String& id)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            if ((id[0] != '/') && (id[0] != '\\') && ((id.getSize() <= 1) || (id[1] != ':')))
+        #else
+            if (id[0] != '/')
+        #endif
+                return getResourcePath() + id;
+            else
+                return id;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
     Texture::ImageLoaderFunc Texture::m_imageLoader = [](const sf::String& filename) -> std::unique_ptr<sf::Image>
         {
@@ -146,23 +164,10 @@ namespace tgui
 
         m_data = nullptr;
 
-        std::shared_ptr<TextureData> data;
-    #ifdef SFML_SYSTEM_WINDOWS
-        if ((id[0] != '/') && (id[0] != '\\') && ((id.getSize() <= 1) || (id[1] != ':')))
-    #else
-        if (id[0] != '/')
-    #endif
-        {
-            data = m_textureLoader(*this, getResourcePath() + id, partRect);
-            if (!data)
-                throw Exception{"Failed to load '" + getResourcePath() + id + "'"};
-        }
-        else
-        {
-            data = m_textureLoader(*this, id, partRect);
-            if (!data)
-                throw Exception{"Failed to load '" + id + "'"};
-        }
+        const sf::String filename = getFilename(id);
+        std::shared_ptr<TextureData> data = m_textureLoader(*this, filename, partRect);
+        if (!data)
+            throw Exception{"Failed to load '" + filename + "'"};
 
         m_id = id;
         setTextureData(data, middleRect);
@@ -334,6 +339,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_future<std::shared_ptr<const sf::Image>> Texture::loadAsync(const sf::String& id)
+    {
+        if (id.isEmpty())
+        {
+            std::promise<std::shared_ptr<const sf::Image>> noImage;
+            noImage.set_value(nullptr);
+            return noImage.get_future().share();
+        }
+
+        return TextureManager::loadImageAsync(getFilename(id));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> Texture::loadAsync(const std::vector<sf::String>& ids)
+    {
+        std::vector<std::string> filenames;
+        for (const auto& id : ids)
+        {
+            if (!id.isEmpty())
+                filenames.push_back(getFilename(id));
+        }
+
+        return TextureManager::loadImagesAsync(filenames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::releaseAsync(const std::vector<sf::String>& ids)
+    {
+        for (const auto& id : ids)
+        {
+            if (!id.isEmpty())
+                TextureManager::releaseAsyncImage(getFilename(id));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::setTextureData(std::shared_ptr<TextureData> data, const sf::IntRect& middleRect)
     {
         if (getData() && (m_destructCallback != nullptr))
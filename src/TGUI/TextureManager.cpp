@@ -27,11 +27,137 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::map<std::string, TextureManager::AsyncImage> TextureManager::m_asyncImages;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Worker threads on which images are loaded. Tasks are executed in the order in which they were added.
+        // The tasks get a parameter that tells whether the threads are being stopped, in which case they should finish without
+        // doing their work. Tasks that are still queued when the threads are stopped are executed with that parameter set,
+        // so that nobody is left waiting for a task that never runs.
+        class ImageLoadingThreads
+        {
+        public:
+            ~ImageLoadingThreads()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_stopping = true;
+                }
+
+                m_condition.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+
+                // Tasks can only remain in the queue when a thread failed to start
+                for (auto& task : m_tasks)
+                    task(true);
+            }
+
+            void addTask(std::function<void(bool stopping)> task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_tasks.push_back(std::move(task));
+
+                    // Threads are only started when all existing ones are busy, with at most one thread per processor core
+                    const std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+                    if ((m_idleThreads < m_tasks.size()) && (m_threads.size() < maxThreads))
+                        m_threads.emplace_back([this]{ run(); });
+                }
+
+                m_condition.notify_one();
+            }
+
+        private:
+            void run()
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                while (true)
+                {
+                    ++m_idleThreads;
+                    m_condition.wait(lock, [this]{ return m_stopping || !m_tasks.empty(); });
+                    --m_idleThreads;
+
+                    if (m_tasks.empty())
+                        return;
+
+                    auto task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                    const bool stopping = m_stopping;
+
+                    lock.unlock();
+                    task(stopping);
+                    lock.lock();
+                }
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::function<void(bool stopping)>> m_tasks;
+            std::vector<std::thread> m_threads;
+            std::size_t m_idleThreads = 0;
+            bool m_stopping = false;
+        };
+
+        ImageLoadingThreads& getImageLoadingThreads()
+        {
+            static ImageLoadingThreads threads;
+            return threads;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Functions to call once an image that is loaded asynchronously has finished loading, or failed to load
+    struct TextureManager::AsyncImageListeners
+    {
+        // Calls the function from the worker thread that loads the image, or immediately when the image was already loaded
+        void add(const std::function<void()>& function)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!finished)
+            {
+                functions.push_back(function);
+                return;
+            }
+
+            lock.unlock();
+            function();
+        }
+
+        void finish()
+        {
+            std::vector<std::function<void()>> functionsToCall;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished = true;
+                functionsToCall.swap(functions);
+            }
+
+            for (const auto& function : functionsToCall)
+                function();
+        }
+
+        std::mutex mutex;
+        std::vector<std::function<void()>> functions;
+        bool finished = false;
+    };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -75,9 +201,18 @@ namespace tgui
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
+        // Load the image, unless it was already being loaded on a worker thread
         auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
+        const auto asyncImageIt = m_asyncImages.find(filename);
+        if (asyncImageIt != m_asyncImages.end())
+        {
+            const auto& image = asyncImageIt->second.image.get();
+            if (image)
+                data->image = std::make_unique<sf::Image>(*image);
+        }
+        else
+            data->image = texture.getImageLoader()(filename);
+
         if (data->image != nullptr)
         {
             // Create a texture from the image
@@ -95,6 +230,7 @@ namespace tgui
 
         // The image could not be loaded
         m_imageMap.erase(imageIt);
+        m_asyncImages.erase(filename);
         return nullptr;
     }
 
@@ -137,7 +273,10 @@ namespace tgui
                     {
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
+                        {
+                            m_asyncImages.erase(imageIt->first);
                             m_imageMap.erase(imageIt);
+                        }
                     }
 
                     return;
@@ -149,6 +288,93 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<std::shared_ptr<const sf::Image>> TextureManager::loadImageAsync(const std::string& filename)
+    {
+        // Don't load the same image twice
+        const auto asyncImageIt = m_asyncImages.find(filename);
+        if (asyncImageIt != m_asyncImages.end())
+            return asyncImageIt->second.image;
+
+        const auto imageLoader = Texture::getImageLoader();
+        auto cancelled = std::make_shared<std::atomic<bool>>(false);
+        auto task = std::make_shared<std::packaged_task<std::shared_ptr<const sf::Image>(bool)>>(
+            [imageLoader,filename,cancelled](bool stopping){
+                if (stopping || *cancelled)
+                    return std::shared_ptr<const sf::Image>{};
+
+                return std::shared_ptr<const sf::Image>{imageLoader(filename)};
+            });
+
+        auto listeners = std::make_shared<AsyncImageListeners>();
+        auto future = task->get_future().share();
+        m_asyncImages[filename] = {future, cancelled, listeners};
+        getImageLoadingThreads().addTask([task,listeners](bool stopping){
+                (*task)(stopping);
+                listeners->finish();
+            });
+
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> TextureManager::loadImagesAsync(const std::vector<std::string>& filenames)
+    {
+        auto promise = std::make_shared<std::promise<void>>();
+        auto future = promise->get_future().share();
+
+        // The image that finishes loading last completes the future, no worker thread has to wait for the others.
+        // The extra count is only released after all listeners were added, so that the future can't become ready too early.
+        auto remainingImages = std::make_shared<std::atomic<std::size_t>>(filenames.size() + 1);
+        const auto imageLoaded = [promise,remainingImages]{
+                if (--*remainingImages == 0)
+                    promise->set_value();
+            };
+
+        for (const auto& filename : filenames)
+        {
+            loadImageAsync(filename);
+            m_asyncImages[filename].listeners->add(imageLoaded);
+        }
+
+        imageLoaded();
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseAsyncImage(const std::string& filename)
+    {
+        // Images that are used by textures are released when the last texture is removed
+        if (m_imageMap.find(filename) != m_imageMap.end())
+            return;
+
+        const auto asyncImageIt = m_asyncImages.find(filename);
+        if (asyncImageIt == m_asyncImages.end())
+            return;
+
+        *asyncImageIt->second.cancelled = true;
+        m_asyncImages.erase(asyncImageIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseAsyncImages()
+    {
+        for (auto asyncImageIt = m_asyncImages.begin(); asyncImageIt != m_asyncImages.end();)
+        {
+            if (m_imageMap.find(asyncImageIt->first) == m_imageMap.end())
+            {
+                *asyncImageIt->second.cancelled = true;
+                asyncImageIt = m_asyncImages.erase(asyncImageIt);
+            }
+            else
+                ++asyncImageIt;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Animation.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -64,7 +65,7 @@ namespace tgui
 
     Widget::Widget()
     {
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribeBatched(this, m_rendererChangedCallback);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,10 +77,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,12 +104,12 @@ namespace tgui
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+        m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+        m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+        m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
 
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribeBatched(this, m_rendererChangedCallback);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,13 +143,13 @@ namespace tgui
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+        m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+        m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+        m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
 
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribeBatched(this, m_rendererChangedCallback);
 
         other.m_renderer = nullptr;
     }
@@ -191,12 +192,12 @@ namespace tgui
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+            m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+            m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+            m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribeBatched(this, m_rendererChangedCallback);
         }
 
         return *this;
@@ -240,12 +241,12 @@ namespace tgui
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+            m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+            m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+            m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribeBatched(this, m_rendererChangedCallback);
 
             other.m_renderer = nullptr;
         }
@@ -265,43 +266,39 @@ namespace tgui
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribeBatched(this, m_rendererChangedCallback);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        // Properties that affect the geometry of the widget only cause a single update after all properties have been applied
+        m_applyingRenderer = true;
+        try
         {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
-
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
+            // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+            // The ids are collected first, as the getters that are called by rendererChanged may add properties to the renderer.
+            // The shared base of copy-on-write renderers is only read, so both renderers keep sharing it.
+            std::vector<PropertyId> properties = oldData->getPropertyIds();
+            const std::vector<PropertyId> newProperties = rendererData->getPropertyIds();
+            const auto oldPropertyCount = properties.size();
+            properties.insert(properties.end(), newProperties.begin(), newProperties.end());
+
+            std::inplace_merge(properties.begin(), properties.begin() + oldPropertyCount, properties.end());
+            properties.erase(std::unique(properties.begin(), properties.end()), properties.end());
+
+            for (const auto property : properties)
+                rendererChanged(property);
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        catch (...)
         {
-            rendererChanged(oldIt->first);
-            ++oldIt;
+            m_applyingRenderer = false;
+            m_geometryUpdatePending = false;
+            throw;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+
+        m_applyingRenderer = false;
+        if (m_geometryUpdatePending)
         {
-            rendererChanged(newIt->first);
-            ++newIt;
+            m_geometryUpdatePending = false;
+            updateGeometry();
         }
     }
 
@@ -327,8 +324,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->setData(m_renderer->createOverlay());
+            m_renderer->subscribeBatched(this, m_rendererChangedCallback);
             m_renderer->getData()->shared = false;
         }
 
@@ -343,8 +340,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->setData(m_renderer->createOverlay());
+            m_renderer->subscribeBatched(this, m_rendererChangedCallback);
             m_renderer->getData()->shared = false;
         }
 
@@ -355,9 +352,20 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
+        const Vector2f previousPosition = m_prevPosition;
+
         m_position = position;
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
+        try
+        {
+            m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+            m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+        }
+        catch (const Exception&)
+        {
+            // The layout would depend on itself, so the widget is kept at its previous position
+            setPosition(previousPosition);
+            throw;
+        }
 
         if (getPosition() != m_prevPosition)
         {
@@ -373,9 +381,20 @@ namespace tgui
 
     void Widget::setSize(const Layout2d& size)
     {
+        const Vector2f previousSize = m_prevSize;
+
         m_size = size;
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        try
+        {
+            m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+            m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
+        }
+        catch (const Exception&)
+        {
+            // The layout would depend on itself, so the widget keeps its previous size
+            setSize(previousSize);
+            throw;
+        }
 
         if (getSize() != m_prevSize)
         {
@@ -616,7 +635,7 @@ namespace tgui
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("font");
+        rendererChanged(PropertyId::FontProperty);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,7 +650,7 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("opacity");
+        rendererChanged(PropertyId::Opacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -673,13 +692,29 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        Container* const previousParent = m_parent;
+        const Layout2d previousPosition = m_position;
+        const Layout2d previousSize = m_size;
+
         m_parent = parent;
 
         // Give the layouts another chance to find widgets to which it refers
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        try
+        {
+            m_position.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Left); });
+            m_position.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Top); });
+            m_size.x.connectWidget(this, true, [this]{ layoutValueChanged(LayoutGraph::Property::Width); });
+            m_size.y.connectWidget(this, false, [this]{ layoutValueChanged(LayoutGraph::Property::Height); });
+        }
+        catch (const Exception&)
+        {
+            // A layout would depend on itself inside the new parent. The widget stays with its previous parent and the
+            // layouts that were already connected are bound to the widgets they referred to before.
+            m_parent = previousParent;
+            setPosition(previousPosition);
+            setSize(previousSize);
+            throw;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -803,35 +838,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Widget::getSignal(std::string signalName)
+    unsigned int Widget::getLayoutEvaluationCount(LayoutGraph::Property property) const
     {
-        if (signalName == toLower(onPositionChange.getName()))
-            return onPositionChange;
-        else if (signalName == toLower(onSizeChange.getName()))
-            return onSizeChange;
-        else if (signalName == toLower(onFocus.getName()))
-            return onFocus;
-        else if (signalName == toLower(onUnfocus.getName()))
-            return onUnfocus;
-        else if (signalName == toLower(onMouseEnter.getName()))
-            return onMouseEnter;
-        else if (signalName == toLower(onMouseLeave.getName()))
-            return onMouseLeave;
-        else if (signalName == toLower(onAnimationFinished.getName()))
-            return onAnimationFinished;
+        return m_layoutStatistics[static_cast<std::size_t>(property)].evaluations;
+    }
 
-        throw Exception{"No signal exists with name '" + std::move(signalName) + "'."};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Widget::getLastLayoutEvaluationTime(LayoutGraph::Property property) const
+    {
+        return m_layoutStatistics[static_cast<std::size_t>(property)].lastEvaluationTime;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChanged(const std::string& property)
+    void Widget::resetLayoutStatistics()
     {
-        if (property == "opacity")
+        for (auto& statistics : m_layoutStatistics)
+            statistics.evaluations = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& Widget::getSignal(const std::string& signalName)
+    {
+        static const SignalTable<Widget> signals{*this, &Widget::onPositionChange, &Widget::onSizeChange, &Widget::onFocus, &Widget::onUnfocus,
+                                                 &Widget::onMouseEnter, &Widget::onMouseLeave, &Widget::onAnimationFinished};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
+
+        throw Exception{"No signal exists with name '" + signalName + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererChanged(PropertyId property)
+    {
+        if (property == PropertyId::Opacity)
         {
             m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             if (getSharedRenderer()->getFont())
                 m_fontCached = getSharedRenderer()->getFont();
@@ -840,12 +887,29 @@ namespace tgui
             else
                 m_fontCached = getGlobalFont();
         }
-        else if (property == "transparenttexture")
+        else if (property == PropertyId::TransparentTexture)
         {
             m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
         }
         else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
+            throw Exception{"Could not set property '" + getPropertyName(property) + "', widget of type '" + getWidgetType() + "' does not has this property."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestGeometryUpdate()
+    {
+        if (m_applyingRenderer)
+            m_geometryUpdatePending = true;
+        else
+            updateGeometry();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateGeometry()
+    {
+        setSize(m_size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1005,9 +1069,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const std::string& property)
+    void Widget::rendererChangedCallback(const std::vector<PropertyId>& properties)
     {
-        rendererChanged(property);
+        if (properties.size() == 1)
+        {
+            rendererChanged(properties.front());
+            return;
+        }
+
+        // When multiple properties changed at once, the geometry of the widget is only updated once at the end
+        const bool wasApplyingRenderer = m_applyingRenderer;
+        m_applyingRenderer = true;
+        try
+        {
+            for (const auto& property : properties)
+                rendererChanged(property);
+        }
+        catch (...)
+        {
+            m_applyingRenderer = wasApplyingRenderer;
+            if (!wasApplyingRenderer)
+                m_geometryUpdatePending = false;
+            throw;
+        }
+
+        m_applyingRenderer = wasApplyingRenderer;
+        if (!wasApplyingRenderer && m_geometryUpdatePending)
+        {
+            m_geometryUpdatePending = false;
+            updateGeometry();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::layoutValueChanged(LayoutGraph::Property property)
+    {
+        // The statistics are only collected while profiling, so that the time isn't measured for every layout change
+        if (!Signal::isProfilingEnabled())
+        {
+            if ((property == LayoutGraph::Property::Left) || (property == LayoutGraph::Property::Top))
+                setPosition(getPositionLayout());
+            else
+                setSize(getSizeLayout());
+
+            return;
+        }
+
+        const sf::Clock clock;
+        if ((property == LayoutGraph::Property::Left) || (property == LayoutGraph::Property::Top))
+            setPosition(getPositionLayout());
+        else
+            setSize(getSizeLayout());
+
+        auto& statistics = m_layoutStatistics[static_cast<std::size_t>(property)];
+        statistics.evaluations++;
+        statistics.lastEvaluationTime = clock.getElapsedTime();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
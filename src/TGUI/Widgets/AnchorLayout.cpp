@@ -0,0 +1,860 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/AnchorLayout.hpp>
+#include <TGUI/SignalImpl.hpp>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        bool isHorizontalEdge(AnchorLayout::Edge edge)
+        {
+            return (edge == AnchorLayout::Edge::Left) || (edge == AnchorLayout::Edge::Right) || (edge == AnchorLayout::Edge::HorizontalCenter);
+        }
+
+        std::string edgeToString(AnchorLayout::Edge edge)
+        {
+            switch (edge)
+            {
+            case AnchorLayout::Edge::Left:
+                return "Left";
+            case AnchorLayout::Edge::Top:
+                return "Top";
+            case AnchorLayout::Edge::Right:
+                return "Right";
+            case AnchorLayout::Edge::Bottom:
+                return "Bottom";
+            case AnchorLayout::Edge::HorizontalCenter:
+                return "HorizontalCenter";
+            case AnchorLayout::Edge::VerticalCenter:
+                return "VerticalCenter";
+            default:
+                throw Exception{"Invalid anchor edge encountered."};
+            }
+        }
+
+        AnchorLayout::Edge edgeFromString(std::string str)
+        {
+            str = toLower(trim(str));
+            if (str == "left")
+                return AnchorLayout::Edge::Left;
+            else if (str == "top")
+                return AnchorLayout::Edge::Top;
+            else if (str == "right")
+                return AnchorLayout::Edge::Right;
+            else if (str == "bottom")
+                return AnchorLayout::Edge::Bottom;
+            else if (str == "horizontalcenter")
+                return AnchorLayout::Edge::HorizontalCenter;
+            else if (str == "verticalcenter")
+                return AnchorLayout::Edge::VerticalCenter;
+            else
+                throw Exception{"Failed to parse anchor edge '" + str + "'."};
+        }
+
+        // Splits a list value of the form "(a, b, c)" in its parts
+        std::vector<std::string> splitListValue(std::string str)
+        {
+            // Remove quotes
+            if ((str.size() >= 2) && (str[0] == '"') && (str[str.size()-1] == '"'))
+                str = str.substr(1, str.size()-2);
+
+            // Remove brackets
+            if ((str.size() >= 2) && (str[0] == '(') && (str[str.size()-1] == ')'))
+                str = str.substr(1, str.size()-2);
+
+            std::vector<std::string> parts;
+            std::size_t index = 0;
+            std::size_t pos = str.find(',');
+            while (pos != std::string::npos)
+            {
+                parts.push_back(trim(str.substr(index, pos - index)));
+                index = pos + 1;
+                pos = str.find(',', index);
+            }
+
+            parts.push_back(trim(str.substr(index)));
+            return parts;
+        }
+
+        // The edges of a widget in one direction. When an edge isn't anchored, its position is ignored.
+        struct AxisEdges
+        {
+            bool startAnchored = false;
+            bool endAnchored = false;
+            bool centerAnchored = false;
+            float start = 0;
+            float end = 0;
+            float center = 0;
+
+            bool isStretched() const
+            {
+                return (startAnchored && (endAnchored || centerAnchored)) || (endAnchored && centerAnchored);
+            }
+
+            float getStretchedSize() const
+            {
+                if (startAnchored && endAnchored)
+                    return end - start;
+                else if (startAnchored)
+                    return 2 * (center - start);
+                else
+                    return 2 * (end - center);
+            }
+
+            float getPosition(float size, float currentPosition) const
+            {
+                if (startAnchored)
+                    return start;
+                else if (endAnchored)
+                    return end - size;
+                else if (centerAnchored)
+                    return center - (size / 2.f);
+                else
+                    return currentPosition;
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::AnchorLayout(const Layout2d& size) :
+        Group{size}
+    {
+        m_type = "AnchorLayout";
+
+        m_renderer = aurora::makeCopied<GroupRenderer>();
+        setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::AnchorLayout(const AnchorLayout& layoutToCopy) :
+        Group{layoutToCopy}
+    {
+        copyConstraints(layoutToCopy);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::AnchorLayout(AnchorLayout&& layoutToMove) :
+        Group               {std::move(layoutToMove)},
+        m_constraints       {std::move(layoutToMove.m_constraints)},
+        m_solveOrder        {},
+        m_solveOrderOutdated{true},
+        m_anchorTargets     {},
+        m_childCallbackIds  {std::move(layoutToMove.m_childCallbackIds)}
+    {
+        // The callbacks of the children still refer to the layout that was moved
+        disconnectChildren();
+        for (const auto& widget : m_widgets)
+            connectChild(*widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout& AnchorLayout::operator= (const AnchorLayout& right)
+    {
+        if (this != &right)
+        {
+            // The old widgets are about to be removed, so we should no longer listen to their changes
+            disconnectChildren();
+            m_constraints.clear();
+
+            Group::operator=(right);
+
+            copyConstraints(right);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout& AnchorLayout::operator= (AnchorLayout&& right)
+    {
+        if (this != &right)
+        {
+            disconnectChildren();
+
+            Group::operator=(std::move(right));
+            m_constraints        = std::move(right.m_constraints);
+            m_childCallbackIds   = std::move(right.m_childCallbackIds);
+            m_solveOrderOutdated = true;
+
+            disconnectChildren();
+            for (const auto& widget : m_widgets)
+                connectChild(*widget);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::Ptr AnchorLayout::create(const Layout2d& size)
+    {
+        return std::make_shared<AnchorLayout>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::Ptr AnchorLayout::copy(AnchorLayout::ConstPtr layout)
+    {
+        if (layout)
+            return std::static_pointer_cast<AnchorLayout>(layout->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setSize(const Layout2d& size)
+    {
+        Group::setSize(size);
+
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::add(const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        Group::add(widget, widgetName);
+
+        connectChild(*widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnchorLayout::remove(const Widget::Ptr& widget)
+    {
+        const auto callbackIt = m_childCallbackIds.find(widget.get());
+        if (callbackIt != m_childCallbackIds.end())
+        {
+            widget->disconnect(callbackIt->second.first);
+            widget->disconnect(callbackIt->second.second);
+            m_childCallbackIds.erase(callbackIt);
+        }
+
+        // Forget the constraints of the widget and the anchors of other widgets that refer to it
+        m_constraints.erase(widget.get());
+        for (auto it = m_constraints.begin(); it != m_constraints.end();)
+        {
+            auto& anchors = it->second.anchors;
+            for (auto anchorIt = anchors.begin(); anchorIt != anchors.end();)
+            {
+                if (anchorIt->second.target == widget.get())
+                    anchorIt = anchors.erase(anchorIt);
+                else
+                    ++anchorIt;
+            }
+
+            const Widget* anchoredWidget = it->first;
+            ++it;
+            removeUnusedConstraints(anchoredWidget);
+        }
+
+        m_solveOrderOutdated = true;
+
+        const bool removed = Group::remove(widget);
+        updateWidgets();
+        return removed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::removeAllWidgets()
+    {
+        disconnectChildren();
+        m_constraints.clear();
+        m_solveOrder.clear();
+        m_anchorTargets.clear();
+        m_solveOrderOutdated = false;
+
+        Group::removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setAnchor(const Widget::Ptr& widget, Edge edge, const Widget::Ptr& target, Edge targetEdge, float margin)
+    {
+        if (!target || (target->getParent() != this))
+            throw Exception{"The target passed to AnchorLayout::setAnchor has to be added to the layout first."};
+        if (target == widget)
+            throw Exception{"A widget can't be anchored to itself in AnchorLayout::setAnchor."};
+
+        addAnchor(widget, edge, target.get(), targetEdge, margin);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setAnchor(const Widget::Ptr& widget, Edge edge, Edge layoutEdge, float margin)
+    {
+        addAnchor(widget, edge, nullptr, layoutEdge, margin);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::removeAnchor(const Widget::Ptr& widget, Edge edge)
+    {
+        const auto it = m_constraints.find(widget.get());
+        if ((it == m_constraints.end()) || (it->second.anchors.erase(edge) == 0))
+            return;
+
+        removeUnusedConstraints(widget.get());
+        m_solveOrderOutdated = true;
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnchorLayout::isAnchored(const Widget::Ptr& widget, Edge edge) const
+    {
+        const auto it = m_constraints.find(widget.get());
+        if (it == m_constraints.end())
+            return false;
+
+        return it->second.anchors.find(edge) != it->second.anchors.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setMinimumSize(const Widget::Ptr& widget, Vector2f minimumSize)
+    {
+        getConstraints(widget).minimumSize = minimumSize;
+        removeUnusedConstraints(widget.get());
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f AnchorLayout::getMinimumSize(const Widget::Ptr& widget) const
+    {
+        const auto it = m_constraints.find(widget.get());
+        if (it != m_constraints.end())
+            return it->second.minimumSize;
+        else
+            return {0, 0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setMaximumSize(const Widget::Ptr& widget, Vector2f maximumSize)
+    {
+        getConstraints(widget).maximumSize = maximumSize;
+        removeUnusedConstraints(widget.get());
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f AnchorLayout::getMaximumSize(const Widget::Ptr& widget) const
+    {
+        const auto it = m_constraints.find(widget.get());
+        if (it != m_constraints.end())
+            return it->second.maximumSize;
+        else
+            return {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::setAspectRatio(const Widget::Ptr& widget, float aspectRatio)
+    {
+        getConstraints(widget).aspectRatio = std::max(0.f, aspectRatio);
+        removeUnusedConstraints(widget.get());
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float AnchorLayout::getAspectRatio(const Widget::Ptr& widget) const
+    {
+        const auto it = m_constraints.find(widget.get());
+        if (it != m_constraints.end())
+            return it->second.aspectRatio;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> AnchorLayout::save(SavingRenderersMap& renderers) const
+    {
+        auto node = Group::save(renderers);
+
+        std::map<const Widget*, std::size_t> widgetIndices;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            widgetIndices[m_widgets[i].get()] = i;
+
+        const auto sizeToString = [](float size){
+                if (size == std::numeric_limits<float>::max())
+                    return std::string{"None"};
+                else
+                    return to_string(size);
+            };
+
+        std::vector<std::string> anchors;
+        std::vector<std::string> sizeConstraints;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const auto it = m_constraints.find(m_widgets[i].get());
+            if (it == m_constraints.end())
+                continue;
+
+            const Constraints& constraints = it->second;
+            for (const auto& pair : constraints.anchors)
+            {
+                anchors.push_back("\"(" + to_string(i)
+                                  + ", " + edgeToString(pair.first)
+                                  + ", " + (pair.second.target ? to_string(widgetIndices[pair.second.target]) : std::string{"Parent"})
+                                  + ", " + edgeToString(pair.second.targetEdge)
+                                  + ", " + to_string(pair.second.margin) + ")\"");
+            }
+
+            if ((constraints.minimumSize != Vector2f{0, 0})
+             || (constraints.maximumSize != Vector2f{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()})
+             || (constraints.aspectRatio != 0))
+            {
+                sizeConstraints.push_back("\"(" + to_string(i)
+                                          + ", " + to_string(constraints.minimumSize.x)
+                                          + ", " + to_string(constraints.minimumSize.y)
+                                          + ", " + sizeToString(constraints.maximumSize.x)
+                                          + ", " + sizeToString(constraints.maximumSize.y)
+                                          + ", " + to_string(constraints.aspectRatio) + ")\"");
+            }
+        }
+
+        const auto listToString = [](const std::vector<std::string>& list){
+                std::string str = "[" + list[0];
+                for (std::size_t i = 1; i < list.size(); ++i)
+                    str += ", " + list[i];
+
+                return str + "]";
+            };
+
+        if (!anchors.empty())
+            node->propertyValuePairs["Anchors"] = std::make_unique<DataIO::ValueNode>(listToString(anchors));
+        if (!sizeConstraints.empty())
+            node->propertyValuePairs["SizeConstraints"] = std::make_unique<DataIO::ValueNode>(listToString(sizeConstraints));
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        Group::load(node, renderers);
+
+        const auto getWidgetFromIndex = [this](const std::string& str, const std::string& property){
+                const int index = tgui::stoi(str);
+                if ((index < 0) || (static_cast<std::size_t>(index) >= m_widgets.size()))
+                    throw Exception{"Failed to parse '" + property + "' property, widget index '" + str + "' is out of range"};
+
+                return m_widgets[static_cast<std::size_t>(index)];
+            };
+
+        if (node->propertyValuePairs["anchors"])
+        {
+            if (!node->propertyValuePairs["anchors"]->listNode)
+                throw Exception{"Failed to parse 'Anchors' property, expected a list as value"};
+
+            for (const auto& element : node->propertyValuePairs["anchors"]->valueList)
+            {
+                const auto parts = splitListValue(element.toAnsiString());
+                if (parts.size() != 5)
+                    throw Exception{"Failed to parse 'Anchors' property. Expected list values to be in the form of '\"(widget, edge, target, targetEdge, margin)\"'."};
+
+                const auto widget = getWidgetFromIndex(parts[0], "Anchors");
+                if (toLower(parts[2]) == "parent")
+                    setAnchor(widget, edgeFromString(parts[1]), edgeFromString(parts[3]), tgui::stof(parts[4]));
+                else
+                    setAnchor(widget, edgeFromString(parts[1]), getWidgetFromIndex(parts[2], "Anchors"), edgeFromString(parts[3]), tgui::stof(parts[4]));
+            }
+        }
+
+        if (node->propertyValuePairs["sizeconstraints"])
+        {
+            if (!node->propertyValuePairs["sizeconstraints"]->listNode)
+                throw Exception{"Failed to parse 'SizeConstraints' property, expected a list as value"};
+
+            const auto sizeFromString = [](const std::string& str){
+                    if (toLower(str) == "none")
+                        return std::numeric_limits<float>::max();
+                    else
+                        return tgui::stof(str);
+                };
+
+            for (const auto& element : node->propertyValuePairs["sizeconstraints"]->valueList)
+            {
+                const auto parts = splitListValue(element.toAnsiString());
+                if (parts.size() != 6)
+                    throw Exception{"Failed to parse 'SizeConstraints' property. Expected list values to be in the form of '\"(widget, minWidth, minHeight, maxWidth, maxHeight, aspectRatio)\"'."};
+
+                const auto widget = getWidgetFromIndex(parts[0], "SizeConstraints");
+                setMinimumSize(widget, {tgui::stof(parts[1]), tgui::stof(parts[2])});
+                setMaximumSize(widget, {sizeFromString(parts[3]), sizeFromString(parts[4])});
+                setAspectRatio(widget, tgui::stof(parts[5]));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::updateWidgets()
+    {
+        if (m_solveOrderOutdated)
+            updateSolveOrder();
+
+        m_updatingWidgets = true;
+        for (const auto& pair : m_solveOrder)
+            solveWidget(*pair.first, *pair.second);
+
+        m_updatingWidgets = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::addAnchor(const Widget::Ptr& widget, Edge edge, const Widget* target, Edge targetEdge, float margin)
+    {
+        if (!widget || (widget->getParent() != this))
+            throw Exception{"The widget passed to AnchorLayout::setAnchor has to be added to the layout first."};
+        if (isHorizontalEdge(edge) != isHorizontalEdge(targetEdge))
+            throw Exception{"AnchorLayout::setAnchor can't anchor the " + edgeToString(edge) + " edge to the " + edgeToString(targetEdge) + " edge."};
+
+        auto& anchors = getConstraints(widget).anchors;
+        const auto oldAnchorIt = anchors.find(edge);
+        const bool hadOldAnchor = (oldAnchorIt != anchors.end());
+        const Anchor oldAnchor = hadOldAnchor ? oldAnchorIt->second : Anchor{};
+
+        Anchor& anchor = anchors[edge];
+        anchor.target = target;
+        anchor.targetEdge = targetEdge;
+        anchor.margin = margin;
+
+        m_solveOrderOutdated = true;
+        if (!updateSolveOrder())
+        {
+            if (hadOldAnchor)
+                anchors[edge] = oldAnchor;
+            else
+                anchors.erase(edge);
+
+            removeUnusedConstraints(widget.get());
+            updateSolveOrder();
+            throw Exception{"AnchorLayout::setAnchor failed, the target is already anchored to the widget."};
+        }
+
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::removeUnusedConstraints(const Widget* widget)
+    {
+        const auto it = m_constraints.find(widget);
+        if (it == m_constraints.end())
+            return;
+
+        const Constraints& constraints = it->second;
+        if (constraints.anchors.empty()
+         && (constraints.minimumSize == Vector2f{0, 0})
+         && (constraints.maximumSize == Vector2f{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()})
+         && (constraints.aspectRatio == 0))
+        {
+            m_constraints.erase(it);
+            m_solveOrderOutdated = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnchorLayout::Constraints& AnchorLayout::getConstraints(const Widget::Ptr& widget)
+    {
+        if (!widget || (widget->getParent() != this))
+            throw Exception{"The widget passed to AnchorLayout has to be added to the layout first."};
+
+        auto it = m_constraints.find(widget.get());
+        if (it == m_constraints.end())
+        {
+            Constraints constraints;
+            constraints.maximumSize = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+            it = m_constraints.insert({widget.get(), constraints}).first;
+            m_solveOrderOutdated = true;
+        }
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnchorLayout::updateSolveOrder()
+    {
+        m_solveOrder.clear();
+        m_anchorTargets.clear();
+
+        // Count for each constrained widget how many other constrained widgets have to be placed before it
+        std::map<const Widget*, std::size_t> dependencyCounts;
+        std::map<const Widget*, std::vector<const Widget*>> dependents;
+        for (const auto& pair : m_constraints)
+        {
+            std::set<const Widget*> targets;
+            for (const auto& anchor : pair.second.anchors)
+            {
+                if (anchor.second.target)
+                    targets.insert(anchor.second.target);
+            }
+
+            std::size_t dependencyCount = 0;
+            for (const auto* target : targets)
+            {
+                m_anchorTargets.insert(target);
+
+                // Widgets without constraints are never moved by the layout and can thus be used immediately
+                if (m_constraints.find(target) != m_constraints.end())
+                {
+                    dependents[target].push_back(pair.first);
+                    ++dependencyCount;
+                }
+            }
+
+            dependencyCounts[pair.first] = dependencyCount;
+        }
+
+        // Place the widgets in the order in which they were added, unless they depend on widgets that come later
+        std::vector<Widget*> readyWidgets;
+        for (const auto& widget : m_widgets)
+        {
+            const auto it = dependencyCounts.find(widget.get());
+            if ((it != dependencyCounts.end()) && (it->second == 0))
+                readyWidgets.push_back(widget.get());
+        }
+
+        std::map<const Widget*, Widget*> children;
+        for (const auto& widget : m_widgets)
+            children[widget.get()] = widget.get();
+
+        for (std::size_t i = 0; i < readyWidgets.size(); ++i)
+        {
+            Widget* widget = readyWidgets[i];
+            m_solveOrder.emplace_back(widget, &m_constraints[widget]);
+
+            for (const auto* dependent : dependents[widget])
+            {
+                if (--dependencyCounts[dependent] == 0)
+                    readyWidgets.push_back(children[dependent]);
+            }
+        }
+
+        m_solveOrderOutdated = false;
+        return m_solveOrder.size() == m_constraints.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float AnchorLayout::getEdgePosition(const Widget* widget, Edge edge) const
+    {
+        Vector2f position;
+        Vector2f size;
+        if (widget)
+        {
+            position = widget->getPosition();
+            size = widget->getFullSize();
+        }
+        else
+            size = getInnerSize();
+
+        switch (edge)
+        {
+        case Edge::Left:
+            return position.x;
+        case Edge::Top:
+            return position.y;
+        case Edge::Right:
+            return position.x + size.x;
+        case Edge::Bottom:
+            return position.y + size.y;
+        case Edge::HorizontalCenter:
+            return position.x + (size.x / 2.f);
+        default: // VerticalCenter
+            return position.y + (size.y / 2.f);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::solveWidget(Widget& widget, const Constraints& constraints)
+    {
+        AxisEdges horizontal;
+        AxisEdges vertical;
+        for (const auto& pair : constraints.anchors)
+        {
+            const Anchor& anchor = pair.second;
+            const float targetPosition = getEdgePosition(anchor.target, anchor.targetEdge);
+            switch (pair.first)
+            {
+            case Edge::Left:
+                horizontal.startAnchored = true;
+                horizontal.start = targetPosition + anchor.margin;
+                break;
+            case Edge::Right:
+                horizontal.endAnchored = true;
+                horizontal.end = targetPosition - anchor.margin;
+                break;
+            case Edge::HorizontalCenter:
+                horizontal.centerAnchored = true;
+                horizontal.center = targetPosition + anchor.margin;
+                break;
+            case Edge::Top:
+                vertical.startAnchored = true;
+                vertical.start = targetPosition + anchor.margin;
+                break;
+            case Edge::Bottom:
+                vertical.endAnchored = true;
+                vertical.end = targetPosition - anchor.margin;
+                break;
+            case Edge::VerticalCenter:
+                vertical.centerAnchored = true;
+                vertical.center = targetPosition + anchor.margin;
+                break;
+            }
+        }
+
+        // The anchors determine the full size, but parts like the title bar of a child window can't be resized
+        const Vector2f decorationSize = widget.getFullSize() - widget.getSize();
+
+        Vector2f size = widget.getSize();
+        if (horizontal.isStretched())
+            size.x = horizontal.getStretchedSize() - decorationSize.x;
+        if (vertical.isStretched())
+            size.y = vertical.getStretchedSize() - decorationSize.y;
+
+        size.x = std::max(constraints.minimumSize.x, std::min(constraints.maximumSize.x, size.x));
+        size.y = std::max(constraints.minimumSize.y, std::min(constraints.maximumSize.y, size.y));
+
+        if (constraints.aspectRatio > 0)
+        {
+            if (horizontal.isStretched() && vertical.isStretched())
+            {
+                // Make the widget as large as possible while still fitting between the anchors
+                if (size.x > size.y * constraints.aspectRatio)
+                    size.x = size.y * constraints.aspectRatio;
+                else
+                    size.y = size.x / constraints.aspectRatio;
+            }
+            else if (vertical.isStretched())
+                size.x = size.y * constraints.aspectRatio;
+            else
+                size.y = size.x / constraints.aspectRatio;
+        }
+
+        if (size != widget.getSize())
+            widget.setSize(size);
+
+        const Vector2f position = {horizontal.getPosition(size.x + decorationSize.x, widget.getPosition().x),
+                                   vertical.getPosition(size.y + decorationSize.y, widget.getPosition().y)};
+        if (position != widget.getPosition())
+            widget.setPosition(position);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::copyConstraints(const AnchorLayout& other)
+    {
+        // The container copied the widgets in the same order, so the index can be used to find the copied widget
+        std::map<const Widget*, const Widget*> copiedWidgets;
+        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
+            copiedWidgets[other.m_widgets[i].get()] = m_widgets[i].get();
+
+        for (const auto& pair : other.m_constraints)
+        {
+            Constraints constraints = pair.second;
+            for (auto& anchor : constraints.anchors)
+            {
+                if (anchor.second.target)
+                    anchor.second.target = copiedWidgets[anchor.second.target];
+            }
+
+            m_constraints[copiedWidgets[pair.first]] = std::move(constraints);
+        }
+
+        for (const auto& widget : m_widgets)
+            connectChild(*widget);
+
+        m_solveOrderOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::connectChild(Widget& widget)
+    {
+        const Widget* widgetPtr = &widget;
+        m_childCallbackIds[widgetPtr] = {widget.connect("SizeChanged", [this, widgetPtr](){ childChanged(widgetPtr); }),
+                                         widget.connect("PositionChanged", [this, widgetPtr](){ childChanged(widgetPtr); })};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::disconnectChildren()
+    {
+        for (const auto& widget : m_widgets)
+        {
+            const auto it = m_childCallbackIds.find(widget.get());
+            if (it != m_childCallbackIds.end())
+            {
+                widget->disconnect(it->second.first);
+                widget->disconnect(it->second.second);
+            }
+        }
+
+        m_childCallbackIds.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnchorLayout::childChanged(const Widget* widget)
+    {
+        // Changes made by the layout itself don't require the widgets to be placed again
+        if (m_updatingWidgets)
+            return;
+
+        if (m_solveOrderOutdated)
+            updateSolveOrder();
+
+        if ((m_constraints.find(widget) != m_constraints.end()) || (m_anchorTargets.find(widget) != m_anchorTargets.end()))
+            updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
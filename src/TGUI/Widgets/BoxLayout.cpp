@@ -140,14 +140,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const std::string& property)
+    void BoxLayout::rendererChanged(PropertyId property)
     {
-        if (property == "spacebetweenwidgets")
+        if (property == PropertyId::SpaceBetweenWidgets)
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
             updateWidgets();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             Group::rendererChanged(property);
 
@@ -252,89 +252,90 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Button::getSignal(std::string signalName)
+    Signal& Button::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onPress.getName()))
-            return onPress;
+        static const SignalTable<Button> signals{*this, &Button::onPress};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Button::rendererChanged(const std::string& property)
+    void Button::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             updateSize();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled") || (property == "textcolorfocused")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled") || (property == "textstylefocused"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorHover) || (property == PropertyId::TextColorDown) || (property == PropertyId::TextColorDisabled) || (property == PropertyId::TextColorFocused)
+              || (property == PropertyId::TextStyleProperty) || (property == PropertyId::TextStyleHover) || (property == PropertyId::TextStyleDown) || (property == PropertyId::TextStyleDisabled) || (property == PropertyId::TextStyleFocused))
         {
             updateTextColorAndStyle();
         }
-        else if (property == "texture")
+        else if (property == PropertyId::TextureProperty)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (property == PropertyId::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedown")
+        else if (property == PropertyId::TextureDown)
         {
             m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
         }
-        else if (property == "texturedisabled")
+        else if (property == PropertyId::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (property == PropertyId::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordown")
+        else if (property == PropertyId::BorderColorDown)
         {
             m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == PropertyId::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == PropertyId::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordown")
+        else if (property == PropertyId::BackgroundColorDown)
         {
             m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorfocused")
+        else if (property == PropertyId::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -346,7 +347,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
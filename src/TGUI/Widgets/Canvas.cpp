@@ -146,11 +146,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Canvas::rendererChanged(const std::string& property)
+    void Canvas::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (property == PropertyId::Opacity)
             m_sprite.setColor(Color::calcColorOpacity(Color::White, getSharedRenderer()->getOpacity()));
     }
 
@@ -449,41 +449,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const std::string& property)
+    void ChatBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::ScrollbarProperty)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -493,7 +493,7 @@ namespace tgui
             for (auto& line : m_lines)
                 line.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
@@ -151,11 +151,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const std::string& property)
+    void CheckBox::rendererChanged(PropertyId property)
     {
-        if (property == "textureunchecked")
+        if (property == PropertyId::TextureUnchecked)
             m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
+        else if (property == PropertyId::TextureChecked)
             m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
 
         RadioButton::rendererChanged(property);
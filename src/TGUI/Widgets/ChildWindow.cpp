@@ -709,34 +709,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ChildWindow::getSignal(std::string signalName)
-    {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onClose.getName()))
-            return onClose;
-        else if (signalName == toLower(onMinimize.getName()))
-            return onMinimize;
-        else if (signalName == toLower(onMaximize.getName()))
-            return onMaximize;
+    Signal& ChildWindow::getSignal(const std::string& signalName)
+    {
+        static const SignalTable<ChildWindow> signals{*this, &ChildWindow::onMousePress, &ChildWindow::onClose, &ChildWindow::onMinimize, &ChildWindow::onMaximize};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Container::getSignal(std::move(signalName));
+            return Container::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const std::string& property)
+    void ChildWindow::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "titlecolor")
+        else if (property == PropertyId::TitleColor)
         {
             m_titleText.setColor(getSharedRenderer()->getTitleColor());
         }
-        else if (property == "texturetitlebar")
+        else if (property == PropertyId::TextureTitleBar)
         {
             m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
@@ -745,35 +740,35 @@ namespace tgui
             if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
                 updateTitleBarHeight();
         }
-        else if (property == "titlebarheight")
+        else if (property == PropertyId::TitleBarHeight)
         {
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             updateTitleBarHeight();
         }
-        else if (property == "borderbelowtitlebar")
+        else if (property == PropertyId::BorderBelowTitleBar)
         {
             m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             setPosition(m_position);
         }
-        else if (property == "paddingbetweenbuttons")
+        else if (property == PropertyId::PaddingBetweenButtons)
         {
             m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
             setPosition(m_position);
         }
-        else if (property == "minimumresizableborderwidth")
+        else if (property == PropertyId::MinimumResizableBorderWidth)
         {
             m_MinimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
         }
-        else if (property == "showtextontitlebuttons")
+        else if (property == PropertyId::ShowTextOnTitleButtons)
         {
             m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
             setTitleButtons(m_titleButtons);
         }
-        else if (property == "closebutton")
+        else if (property == PropertyId::CloseButton)
         {
             if (m_closeButton->isVisible())
             {
@@ -783,7 +778,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "maximizebutton")
+        else if (property == PropertyId::MaximizeButton)
         {
             if (m_maximizeButton->isVisible())
             {
@@ -793,7 +788,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "minimizebutton")
+        else if (property == PropertyId::MinimizeButton)
         {
             if (m_minimizeButton->isVisible())
             {
@@ -803,19 +798,19 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "titlebarcolor")
+        else if (property == PropertyId::TitleBarColor)
         {
             m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Container::rendererChanged(property);
 
@@ -828,7 +823,7 @@ namespace tgui
             m_titleText.setOpacity(m_opacityCached);
             m_spriteTitleBar.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Container::rendererChanged(property);
 
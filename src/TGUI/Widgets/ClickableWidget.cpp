@@ -90,16 +90,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ClickableWidget::getSignal(std::string signalName)
+    Signal& ClickableWidget::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
+        static const SignalTable<ClickableWidget> signals{*this, &ClickableWidget::onMousePress, &ClickableWidget::onMouseRelease, &ClickableWidget::onClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
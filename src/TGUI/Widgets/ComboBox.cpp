@@ -556,78 +556,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ComboBox::getSignal(std::string signalName)
+    Signal& ComboBox::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
+        static const SignalTable<ComboBox> signals{*this, &ComboBox::onItemSelect};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const std::string& property)
+    void ComboBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_text.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             m_text.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturearrow")
+        else if (property == PropertyId::TextureArrow)
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturearrowhover")
+        else if (property == PropertyId::TextureArrowHover)
         {
             m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
         }
-        else if (property == "listbox")
+        else if (property == PropertyId::ListBoxProperty)
         {
             m_listBox->setRenderer(getSharedRenderer()->getListBox());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (property == PropertyId::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (property == PropertyId::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -637,14 +638,14 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
             m_text.setFont(m_fontCached);
             m_listBox->setInheritedFont(m_fontCached);
 
-            setSize(m_size);
+            requestGeometryUpdate();
         }
         else
             Widget::rendererChanged(property);
@@ -942,26 +942,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& EditBox::getSignal(std::string signalName)
+    Signal& EditBox::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else if (signalName == toLower(onReturnKeyPress.getName()))
-            return onReturnKeyPress;
+        static const SignalTable<EditBox> signals{*this, &EditBox::onTextChange, &EditBox::onReturnKeyPress};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const std::string& property)
+    void EditBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
@@ -970,40 +969,40 @@ namespace tgui
 
             m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if (property == "caretwidth")
+        else if (property == PropertyId::CaretWidth)
         {
             m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
             m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorDisabled) || (property == PropertyId::TextColorFocused))
         {
             updateTextColor();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "defaulttextcolor")
+        else if (property == PropertyId::DefaultTextColor)
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == "texture")
+        else if (property == PropertyId::TextureProperty)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (property == PropertyId::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedisabled")
+        else if (property == PropertyId::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (property == PropertyId::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             const TextStyle style = getSharedRenderer()->getTextStyle();
             m_textBeforeSelection.setStyle(style);
@@ -1011,59 +1010,59 @@ namespace tgui
             m_textSelection.setStyle(style);
             m_textFull.setStyle(style);
         }
-        else if (property == "defaulttextstyle")
+        else if (property == PropertyId::DefaultTextStyle)
         {
             m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == PropertyId::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == PropertyId::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorfocused")
+        else if (property == PropertyId::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if (property == "caretcolor")
+        else if (property == PropertyId::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretcolorhover")
+        else if (property == PropertyId::CaretColorHover)
         {
             m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
         }
-        else if (property == "caretcolorfocused")
+        else if (property == PropertyId::CaretColorFocused)
         {
             m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == PropertyId::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -1077,7 +1076,7 @@ namespace tgui
             m_spriteDisabled.setOpacity(m_opacityCached);
             m_spriteFocused.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
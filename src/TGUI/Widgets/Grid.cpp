@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <numeric>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,38 +45,28 @@ namespace tgui
         Container {gridToCopy},
         m_autoSize{gridToCopy.m_autoSize}
     {
-        for (std::size_t row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
-            {
-                // Find the widget that belongs in this square
-                for (std::size_t i = 0; i < gridToCopy.m_widgets.size(); ++i)
-                {
-                    // If a widget matches then add it to the grid
-                    if (gridToCopy.m_widgets[i] == gridToCopy.m_gridWidgets[row][col])
-                        addWidget(m_widgets[i], row, col, gridToCopy.m_objPadding[row][col], gridToCopy.m_objAlignment[row][col]);
-                }
-            }
-        }
+        copyCells(gridToCopy);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Grid::Grid(Grid&& gridToMove) :
-        Container           {std::move(gridToMove)},
-        m_autoSize          {std::move(gridToMove.m_autoSize)},
-        m_gridWidgets       {std::move(gridToMove.m_gridWidgets)},
-        m_objPadding        {std::move(gridToMove.m_objPadding)},
-        m_objAlignment      {std::move(gridToMove.m_objAlignment)},
-        m_rowHeight         {std::move(gridToMove.m_rowHeight)},
-        m_columnWidth       {std::move(gridToMove.m_columnWidth)},
-        m_connectedCallbacks{}
-    {
-        for (auto& widget : m_widgets)
-        {
-            widget->disconnect(gridToMove.m_connectedCallbacks[widget]);
-            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
-        }
+        Container            {std::move(gridToMove)},
+        m_autoSize           {std::move(gridToMove.m_autoSize)},
+        m_rowHeight          {std::move(gridToMove.m_rowHeight)},
+        m_columnWidth        {std::move(gridToMove.m_columnWidth)},
+        m_cells              {std::move(gridToMove.m_cells)},
+        m_widgetCells        {std::move(gridToMove.m_widgetCells)},
+        m_spanningCells      {std::move(gridToMove.m_spanningCells)},
+        m_rowExtents         {std::move(gridToMove.m_rowExtents)},
+        m_columnExtents      {std::move(gridToMove.m_columnExtents)},
+        m_rowOffsets         {std::move(gridToMove.m_rowOffsets)},
+        m_columnOffsets      {std::move(gridToMove.m_columnOffsets)},
+        m_extraOffset        {std::move(gridToMove.m_extraOffset)},
+        m_gridWidgets        {},
+        m_gridWidgetsOutdated{true}
+    {
+        reconnectCells();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,23 +76,13 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // The old widgets are about to be removed, so we should no longer listen to their size changes
+            removeAllCells();
+
             Container::operator=(right);
             m_autoSize = right.m_autoSize;
-            m_connectedCallbacks.clear();
 
-            for (std::size_t row = 0; row < right.m_gridWidgets.size(); ++row)
-            {
-                for (std::size_t col = 0; col < right.m_gridWidgets[row].size(); ++col)
-                {
-                    // Find the widget that belongs in this square
-                    for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
-                    {
-                        // If a widget matches then add it to the grid
-                        if (right.m_widgets[i] == right.m_gridWidgets[row][col])
-                            addWidget(m_widgets[i], row, col, right.m_objPadding[row][col], right.m_objAlignment[row][col]);
-                    }
-                }
-            }
+            copyCells(right);
         }
 
         return *this;
@@ -112,20 +94,23 @@ namespace tgui
     {
         if (this != &right)
         {
+            removeAllCells();
+
             Container::operator=(std::move(right));
-            m_autoSize           = std::move(right.m_autoSize);
-            m_gridWidgets        = std::move(right.m_gridWidgets);
-            m_objPadding         = std::move(right.m_objPadding);
-            m_objAlignment       = std::move(right.m_objAlignment);
-            m_rowHeight          = std::move(right.m_rowHeight);
-            m_columnWidth        = std::move(right.m_columnWidth);
-            m_connectedCallbacks = std::move(right.m_connectedCallbacks);
-
-            for (auto& widget : m_widgets)
-            {
-                widget->disconnect(right.m_connectedCallbacks[widget]);
-                m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
-            }
+            m_autoSize            = std::move(right.m_autoSize);
+            m_rowHeight           = std::move(right.m_rowHeight);
+            m_columnWidth         = std::move(right.m_columnWidth);
+            m_cells               = std::move(right.m_cells);
+            m_widgetCells         = std::move(right.m_widgetCells);
+            m_spanningCells       = std::move(right.m_spanningCells);
+            m_rowExtents          = std::move(right.m_rowExtents);
+            m_columnExtents       = std::move(right.m_columnExtents);
+            m_rowOffsets          = std::move(right.m_rowOffsets);
+            m_columnOffsets       = std::move(right.m_columnOffsets);
+            m_extraOffset         = std::move(right.m_extraOffset);
+            m_gridWidgetsOutdated = true;
+
+            reconnectCells();
         }
 
         return *this;
@@ -181,57 +166,14 @@ namespace tgui
 
     bool Grid::remove(const Widget::Ptr& widget)
     {
-        const auto callbackIt = m_connectedCallbacks.find(widget);
-        if (callbackIt != m_connectedCallbacks.end())
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
         {
-            widget->disconnect(callbackIt->second);
-            m_connectedCallbacks.erase(callbackIt);
-        }
-
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objPadding[row].erase(m_objPadding[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
-
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
-                    {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
-
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
-                    }
-
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
-                    {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objPadding.erase(m_objPadding.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
-                    }
-
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
-                }
-            }
+            // Only the rows and columns in which the widget was located can change size
+            const CellIndex index = cellIt->first;
+            eraseCell(cellIt);
+            resizeToUsedCells();
+            updateCell(index);
         }
 
         return Container::remove(widget);
@@ -241,16 +183,9 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
-        Container::removeAllWidgets();
-
-        m_gridWidgets.clear();
-        m_objPadding.clear();
-        m_objAlignment.clear();
+        removeAllCells();
 
-        m_rowHeight.clear();
-        m_columnWidth.clear();
-
-        m_connectedCallbacks.clear();
+        Container::removeAllWidgets();
 
         updateWidgets();
     }
@@ -260,53 +195,55 @@ namespace tgui
     void Grid::addWidget(const Widget::Ptr& widget, std::size_t row, std::size_t col, const Padding& padding, Alignment alignment)
     {
         // If the widget hasn't already been added then add it now
-        if (std::find(getWidgets().begin(), getWidgets().end(), widget) == getWidgets().end())
+        if (widget->getParent() != this)
             add(widget);
 
-        // Create the row if it did not exist yet
-        if (m_gridWidgets.size() < row + 1)
+        // A widget can only be located in a single cell, so remove it from the cell it was in before
+        bool cellsRemoved = false;
+        const auto oldCellIt = findCell(widget.get());
+        if (oldCellIt != m_cells.end())
         {
-            m_gridWidgets.resize(row + 1);
-            m_objPadding.resize(row + 1);
-            m_objAlignment.resize(row + 1);
+            eraseCell(oldCellIt);
+            cellsRemoved = true;
         }
 
-        // Create the column if it did not exist yet
-        if (m_gridWidgets[row].size() < col + 1)
+        // If there already was a widget in the cell then it will remain in the container, but it is no longer part of the grid
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
         {
-            m_gridWidgets[row].resize(col + 1, nullptr);
-            m_objPadding[row].resize(col + 1);
-            m_objAlignment[row].resize(col + 1);
+            eraseCell(cellIt);
+            cellsRemoved = true;
         }
 
-        // If this is a new row then reserve some space for it
-        if (m_rowHeight.size() < row + 1)
-            m_rowHeight.resize(row + 1, 0);
-
-        // If this is the first row to have so many columns then reserve some space for it
-        if (m_columnWidth.size() < col + 1)
-            m_columnWidth.resize(col + 1, 0);
-
-        // Add the widget to the grid
-        m_gridWidgets[row][col] = widget;
-        m_objPadding[row][col] = padding;
-        m_objAlignment[row][col] = alignment;
+        if (cellsRemoved)
+            resizeToUsedCells();
 
-        // Update the widgets
-        updateWidgets();
+        Cell cell;
+        cell.widget = widget;
+        cell.padding = padding;
+        cell.alignment = alignment;
+        insertCell({row, col}, std::move(cell));
 
-        // Automatically update the widgets when their size changes
-        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+        updateCell({row, col});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Grid::getWidget(std::size_t row, std::size_t col) const
     {
-        if ((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size()))
-            return m_gridWidgets[row][col];
-        else
-            return nullptr;
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
+            return cellIt->second.widget;
+
+        // The cell may be covered by a widget that spans multiple rows or columns
+        for (const auto& index : m_spanningCells)
+        {
+            const Cell& cell = m_cells.find(index)->second;
+            if ((row >= index.first) && (row < index.first + cell.rowSpan) && (col >= index.second) && (col < index.second + cell.columnSpan))
+                return cell.widget;
+        }
+
+        return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,14 +252,8 @@ namespace tgui
     {
         std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> widgetsMap;
 
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col])
-                    widgetsMap[m_gridWidgets[row][col]] = {row, col};
-            }
-        }
+        for (const auto& pair : m_cells)
+            widgetsMap[pair.second.widget] = pair.first;
 
         return widgetsMap;
     }
@@ -331,28 +262,24 @@ namespace tgui
 
     void Grid::setWidgetPadding(const Widget::Ptr& widget, const Padding& padding)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetPadding(row, col, padding);
-            }
-        }
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            setWidgetPadding(cellIt->first.first, cellIt->first.second, padding);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetPadding(std::size_t row, std::size_t col, const Padding& padding)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
         {
             // Change padding of the widget
-            m_objPadding[row][col] = padding;
+            removeCellExtent(cellIt->first, cellIt->second);
+            cellIt->second.padding = padding;
+            addCellExtent(cellIt->first, cellIt->second);
 
-            // Update all widgets
-            updateWidgets();
+            updateCell(cellIt->first);
         }
     }
 
@@ -360,25 +287,20 @@ namespace tgui
 
     Padding Grid::getWidgetPadding(const Widget::Ptr& widget) const
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetPadding(row, col);
-            }
-        }
-
-        return {};
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            return cellIt->second.padding;
+        else
+            return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Padding Grid::getWidgetPadding(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objPadding[row][col];
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
+            return cellIt->second.padding;
         else
             return {};
     }
@@ -387,25 +309,21 @@ namespace tgui
 
     void Grid::setWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetAlignment(row, col, alignment);
-            }
-        }
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            setWidgetAlignment(cellIt->first.first, cellIt->first.second, alignment);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetAlignment(std::size_t row, std::size_t col, Alignment alignment)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
         {
-            m_objAlignment[row][col] = alignment;
-            updatePositionsOfAllWidgets();
+            // The alignment doesn't influence the size of the cell, so only the widget itself has to be moved
+            cellIt->second.alignment = alignment;
+            updateCellPosition(cellIt->first, cellIt->second);
         }
     }
 
@@ -413,32 +331,117 @@ namespace tgui
 
     Grid::Alignment Grid::getWidgetAlignment(const Widget::Ptr& widget) const
     {
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetAlignment(row, col);
-            }
-        }
-
-        return Alignment::Center;
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            return cellIt->second.alignment;
+        else
+            return Alignment::Center;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Grid::Alignment Grid::getWidgetAlignment(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objAlignment[row][col];
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
+            return cellIt->second.alignment;
         else
             return Alignment::Center;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::setWidgetSpan(const Widget::Ptr& widget, std::size_t rowSpan, std::size_t columnSpan)
+    {
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            setWidgetSpan(cellIt->first.first, cellIt->first.second, rowSpan, columnSpan);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::setWidgetSpan(std::size_t row, std::size_t col, std::size_t rowSpan, std::size_t columnSpan)
+    {
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt == m_cells.end())
+            return;
+
+        Cell& cell = cellIt->second;
+        removeCellExtent(cellIt->first, cell);
+
+        cell.rowSpan = std::max<std::size_t>(rowSpan, 1);
+        cell.columnSpan = std::max<std::size_t>(columnSpan, 1);
+
+        if ((cell.rowSpan > 1) || (cell.columnSpan > 1))
+            m_spanningCells.insert(cellIt->first);
+        else
+            m_spanningCells.erase(cellIt->first);
+
+        resizeToUsedCells();
+        addCellExtent(cellIt->first, cell);
+
+        updateCell(cellIt->first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<std::size_t, std::size_t> Grid::getWidgetSpan(const Widget::Ptr& widget) const
+    {
+        const auto cellIt = findCell(widget.get());
+        if (cellIt != m_cells.end())
+            return {cellIt->second.rowSpan, cellIt->second.columnSpan};
+        else
+            return {1, 1};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<std::size_t, std::size_t> Grid::getWidgetSpan(std::size_t row, std::size_t col) const
+    {
+        const auto cellIt = m_cells.find({row, col});
+        if (cellIt != m_cells.end())
+            return {cellIt->second.rowSpan, cellIt->second.columnSpan};
+        else
+            return {1, 1};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Grid::getRowCount() const
+    {
+        return m_rowExtents.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Grid::getColumnCount() const
+    {
+        return m_columnExtents.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const std::vector<std::vector<Widget::Ptr>>& Grid::getGridWidgets() const
     {
+        if (m_gridWidgetsOutdated)
+        {
+            m_gridWidgets.clear();
+            for (const auto& pair : m_cells)
+            {
+                const std::size_t row = pair.first.first;
+                const std::size_t col = pair.first.second;
+
+                if (m_gridWidgets.size() < row + 1)
+                    m_gridWidgets.resize(row + 1);
+                if (m_gridWidgets[row].size() < col + 1)
+                    m_gridWidgets[row].resize(col + 1, nullptr);
+
+                m_gridWidgets[row][col] = pair.second.widget;
+            }
+
+            m_gridWidgetsOutdated = false;
+        }
+
         return m_gridWidgets;
     }
 
@@ -491,11 +494,17 @@ namespace tgui
                 {
                     const auto row = it->second.first;
                     const auto col = it->second.second;
-                    return "\"(" + to_string(row)
-                         + ", " + to_string(col)
-                         + ", " + getWidgetPadding(row, col).toString()
-                         + ", " + alignmentToString(getWidgetAlignment(row, col))
-                         + ")\"";
+                    std::string str = "\"(" + to_string(row)
+                                    + ", " + to_string(col)
+                                    + ", " + getWidgetPadding(row, col).toString()
+                                    + ", " + alignmentToString(getWidgetAlignment(row, col));
+
+                    // The span is only saved when the widget occupies more than one cell
+                    const auto span = getWidgetSpan(row, col);
+                    if ((span.first != 1) || (span.second != 1))
+                        str += ", " + to_string(span.first) + ", " + to_string(span.second);
+
+                    return str + ")\"";
                 }
                 else
                     return "\"()\"";
@@ -590,7 +599,28 @@ namespace tgui
                 if (pos == std::string::npos)
                     throw Exception{"Failed to parse 'GridWidgets' property. Expected list values to be in the form of '\"(row, column, (padding), alignment)\"'. Missing comma after padding."};
 
-                std::string alignmentStr = toLower(trim(str.substr(pos + 1)));
+                // The alignment can optionally be followed by the row and column span
+                std::string alignmentStr = str.substr(pos + 1);
+                std::size_t rowSpan = 1;
+                std::size_t columnSpan = 1;
+                pos = alignmentStr.find(',');
+                if (pos != std::string::npos)
+                {
+                    const std::size_t spanPos = alignmentStr.find(',', pos + 1);
+                    if (spanPos == std::string::npos)
+                        throw Exception{"Failed to parse 'GridWidgets' property. Expected list values to be in the form of '\"(row, column, (padding), alignment, rowSpan, columnSpan)\"'. Missing comma after row span."};
+
+                    const int rowSpanValue = tgui::stoi(alignmentStr.substr(pos + 1, spanPos - pos - 1));
+                    const int columnSpanValue = tgui::stoi(alignmentStr.substr(spanPos + 1));
+                    if (rowSpanValue < 1 || columnSpanValue < 1)
+                        throw Exception{"Failed to parse 'GridWidgets' property, row and column span have to be positive integers"};
+
+                    rowSpan = static_cast<std::size_t>(rowSpanValue);
+                    columnSpan = static_cast<std::size_t>(columnSpanValue);
+                    alignmentStr = alignmentStr.substr(0, pos);
+                }
+
+                alignmentStr = toLower(trim(alignmentStr));
                 if (alignmentStr == "center")
                     alignment = Grid::Alignment::Center;
                 else if (alignmentStr == "upperleft")
@@ -613,6 +643,8 @@ namespace tgui
                     throw Exception{"Failed to parse 'GridWidgets' property. Invalid alignment '" + alignmentStr + "'."};
 
                 addWidget(getWidgets()[i], static_cast<std::size_t>(row), static_cast<std::size_t>(col), padding, alignment);
+                if ((rowSpan != 1) || (columnSpan != 1))
+                    setWidgetSpan(static_cast<std::size_t>(row), static_cast<std::size_t>(col), rowSpan, columnSpan);
             }
         }
     }
@@ -639,134 +671,419 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
-        Vector2f extraOffset;
-        if (!m_autoSize && m_gridWidgets.size() > 1)
+        m_extraOffset = getExtraOffset();
+
+        for (const auto& pair : m_cells)
+            updateCellPosition(pair.first, pair.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateWidgets()
+    {
+        // Recalculate the extents of all cells
+        for (auto& extents : m_rowExtents)
+            extents.clear();
+        for (auto& extents : m_columnExtents)
+            extents.clear();
+
+        for (auto& pair : m_cells)
+            addCellExtent(pair.first, pair.second);
+
+        updateRowAndColumnSizes();
+
+        if (m_autoSize)
+            Container::setSize(getMinimumSize());
+
+        updatePositionsOfAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::insertCell(const CellIndex& index, Cell cell)
+    {
+        const Widget* widget = cell.widget.get();
+
+        // Automatically update the layout when the size of the widget changes
+        cell.sizeChangedCallbackId = cell.widget->connect("SizeChanged", [this, widget](){ widgetSizeChanged(widget); });
+
+        if ((cell.rowSpan > 1) || (cell.columnSpan > 1))
+            m_spanningCells.insert(index);
+
+        // Create the rows and columns if they did not exist yet
+        if (m_rowExtents.size() < index.first + cell.rowSpan)
+            m_rowExtents.resize(index.first + cell.rowSpan);
+        if (m_columnExtents.size() < index.second + cell.columnSpan)
+            m_columnExtents.resize(index.second + cell.columnSpan);
+
+        m_widgetCells[widget] = index;
+        addCellExtent(index, m_cells.emplace(index, std::move(cell)).first->second);
+
+        m_gridWidgetsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::eraseCell(std::map<CellIndex, Cell>::iterator cellIt)
+    {
+        const Cell& cell = cellIt->second;
+        cell.widget->disconnect(cell.sizeChangedCallbackId);
+
+        removeCellExtent(cellIt->first, cell);
+        m_spanningCells.erase(cellIt->first);
+        m_widgetCells.erase(cell.widget.get());
+        m_cells.erase(cellIt);
+
+        m_gridWidgetsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::removeAllCells()
+    {
+        for (const auto& pair : m_cells)
+            pair.second.widget->disconnect(pair.second.sizeChangedCallbackId);
+
+        m_cells.clear();
+        m_widgetCells.clear();
+        m_spanningCells.clear();
+        m_rowExtents.clear();
+        m_columnExtents.clear();
+
+        m_gridWidgetsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::addCellExtent(const CellIndex& index, Cell& cell)
+    {
+        const Vector2f widgetSize = cell.widget->getFullSize();
+        cell.extent = {widgetSize.x + cell.padding.getLeft() + cell.padding.getRight(),
+                       widgetSize.y + cell.padding.getTop() + cell.padding.getBottom()};
+
+        // Cells that span multiple rows or columns are only taken into account after the sizes of the normal cells are known
+        if (cell.rowSpan == 1)
+            m_rowExtents[index.first].insert(cell.extent.y);
+        if (cell.columnSpan == 1)
+            m_columnExtents[index.second].insert(cell.extent.x);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::removeCellExtent(const CellIndex& index, const Cell& cell)
+    {
+        if (cell.rowSpan == 1)
         {
-            const Vector2f minimumSize = getMinimumSize();
-            if (getSize().x > minimumSize.x)
-                extraOffset.x = (getSize().x - minimumSize.x) / (m_gridWidgets.size() - 1);
-            if (getSize().y > minimumSize.y)
-                extraOffset.y = (getSize().y - minimumSize.y) / (m_gridWidgets.size() - 1);
+            auto& extents = m_rowExtents[index.first];
+            const auto it = extents.find(cell.extent.y);
+            if (it != extents.end())
+                extents.erase(it);
         }
 
-        Vector2f position;
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        if (cell.columnSpan == 1)
         {
-            const Vector2f previousPosition = position;
+            auto& extents = m_columnExtents[index.second];
+            const auto it = extents.find(cell.extent.x);
+            if (it != extents.end())
+                extents.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+    void Grid::resizeToUsedCells()
+    {
+        std::size_t rowCount = 0;
+        std::size_t columnCount = 0;
+        for (const auto& pair : m_cells)
+        {
+            rowCount = std::max(rowCount, pair.first.first + pair.second.rowSpan);
+            columnCount = std::max(columnCount, pair.first.second + pair.second.columnSpan);
+        }
+
+        m_rowExtents.resize(rowCount);
+        m_columnExtents.resize(columnCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateRowAndColumnSizes()
+    {
+        // The size of each row and column is determined by the largest cell in it
+        m_rowHeight.assign(m_rowExtents.size(), 0);
+        for (std::size_t row = 0; row < m_rowExtents.size(); ++row)
+        {
+            if (!m_rowExtents[row].empty())
+                m_rowHeight[row] = *m_rowExtents[row].rbegin();
+        }
+
+        m_columnWidth.assign(m_columnExtents.size(), 0);
+        for (std::size_t col = 0; col < m_columnExtents.size(); ++col)
+        {
+            if (!m_columnExtents[col].empty())
+                m_columnWidth[col] = *m_columnExtents[col].rbegin();
+        }
+
+        // When a widget spanning multiple rows or columns doesn't fit, the missing space is divided over the rows or columns it covers
+        for (const auto& index : m_spanningCells)
+        {
+            const Cell& cell = m_cells.find(index)->second;
+            if (cell.rowSpan > 1)
             {
-                if (m_gridWidgets[row][col].get() == nullptr)
+                const auto firstRow = m_rowHeight.begin() + index.first;
+                const float totalHeight = std::accumulate(firstRow, firstRow + cell.rowSpan, 0.f);
+                if (totalHeight < cell.extent.y)
                 {
-                    position.x += m_columnWidth[col] + extraOffset.x;
-                    continue;
+                    for (auto it = firstRow; it != firstRow + cell.rowSpan; ++it)
+                        *it += (cell.extent.y - totalHeight) / cell.rowSpan;
                 }
+            }
 
-                Vector2f cellPosition = position + (extraOffset / 2.f);
-                switch (m_objAlignment[row][col])
+            if (cell.columnSpan > 1)
+            {
+                const auto firstColumn = m_columnWidth.begin() + index.second;
+                const float totalWidth = std::accumulate(firstColumn, firstColumn + cell.columnSpan, 0.f);
+                if (totalWidth < cell.extent.x)
                 {
-                case Alignment::UpperLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::Up:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Bottom:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::BottomLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Left:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::Center:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
+                    for (auto it = firstColumn; it != firstColumn + cell.columnSpan; ++it)
+                        *it += (cell.extent.x - totalWidth) / cell.columnSpan;
                 }
-
-                m_gridWidgets[row][col]->setPosition(cellPosition);
-                position.x += m_columnWidth[col] + extraOffset.x;
             }
+        }
 
-            // Move to the next row
-            position = previousPosition;
-            position.y += m_rowHeight[row] + extraOffset.y;
+        m_rowOffsets.resize(m_rowHeight.size());
+        float offset = 0;
+        for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+        {
+            m_rowOffsets[row] = offset;
+            offset += m_rowHeight[row];
+        }
+
+        m_columnOffsets.resize(m_columnWidth.size());
+        offset = 0;
+        for (std::size_t col = 0; col < m_columnWidth.size(); ++col)
+        {
+            m_columnOffsets[col] = offset;
+            offset += m_columnWidth[col];
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Grid::updateWidgets()
+    void Grid::updateCell(const CellIndex& index)
     {
-        // Reset the column widths
-        for (float& width : m_columnWidth)
-            width = 0;
+        const std::vector<float> oldRowHeight = m_rowHeight;
+        const std::vector<float> oldColumnWidth = m_columnWidth;
+        updateRowAndColumnSizes();
+
+        const auto findFirstChange = [](const std::vector<float>& oldSizes, const std::vector<float>& newSizes) -> std::size_t {
+            const std::size_t count = std::min(oldSizes.size(), newSizes.size());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (oldSizes[i] != newSizes[i])
+                    return i;
+            }
 
-        // Loop through all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+            if (oldSizes.size() != newSizes.size())
+                return count;
+            else
+                return std::numeric_limits<std::size_t>::max();
+        };
+
+        std::size_t firstChangedRow = findFirstChange(oldRowHeight, m_rowHeight);
+        std::size_t firstChangedColumn = findFirstChange(oldColumnWidth, m_columnWidth);
+        if ((firstChangedRow != std::numeric_limits<std::size_t>::max()) || (firstChangedColumn != std::numeric_limits<std::size_t>::max()))
         {
-            // Reset the row height
-            m_rowHeight[row] = 0;
+            if (m_autoSize)
+                Container::setSize(getMinimumSize());
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+            // When the extra space between the cells changes then all widgets have to be moved
+            const Vector2f extraOffset = getExtraOffset();
+            if (extraOffset != m_extraOffset)
             {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                    continue;
+                m_extraOffset = extraOffset;
+                firstChangedRow = 0;
+                firstChangedColumn = 0;
+            }
 
-                // Remember the biggest column width
-                if (m_columnWidth[col] < m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight())
-                    m_columnWidth[col] = m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight();
+            // Widgets located before the changed row and column keep their position
+            updatePositionsOfWidgets(firstChangedRow, firstChangedColumn);
+        }
 
-                // Remember the biggest row height
-                if (m_rowHeight[row] < m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom())
-                    m_rowHeight[row] = m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom();
-            }
+        // The widget in the changed cell may have to be moved inside its cell, even when the cell size remained the same
+        const auto cellIt = m_cells.find(index);
+        if (cellIt != m_cells.end())
+            updateCellPosition(cellIt->first, cellIt->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::widgetSizeChanged(const Widget* widget)
+    {
+        const auto cellIt = findCell(widget);
+        if (cellIt == m_cells.end())
+            return;
+
+        removeCellExtent(cellIt->first, cellIt->second);
+        addCellExtent(cellIt->first, cellIt->second);
+        updateCell(cellIt->first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updatePositionsOfWidgets(std::size_t firstRow, std::size_t firstColumn)
+    {
+        for (const auto& pair : m_cells)
+        {
+            const CellIndex& index = pair.first;
+            if ((index.first + pair.second.rowSpan > firstRow) || (index.second + pair.second.columnSpan > firstColumn))
+                updateCellPosition(index, pair.second);
         }
+    }
 
-        if (m_autoSize)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateCellPosition(const CellIndex& index, const Cell& cell)
+    {
+        const std::size_t row = index.first;
+        const std::size_t col = index.second;
+
+        Vector2f cellSize = {(cell.columnSpan - 1) * m_extraOffset.x, (cell.rowSpan - 1) * m_extraOffset.y};
+        for (std::size_t i = 0; i < cell.columnSpan; ++i)
+            cellSize.x += m_columnWidth[col + i];
+        for (std::size_t i = 0; i < cell.rowSpan; ++i)
+            cellSize.y += m_rowHeight[row + i];
+
+        const Padding& padding = cell.padding;
+        const Vector2f widgetSize = cell.widget->getFullSize();
+
+        Vector2f cellPosition{m_columnOffsets[col] + (col * m_extraOffset.x) + (m_extraOffset.x / 2.f),
+                              m_rowOffsets[row] + (row * m_extraOffset.y) + (m_extraOffset.y / 2.f)};
+        switch (cell.alignment)
         {
-            sf::Vector2f size;
-            for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-            {
-                float rowWidth = 0;
-                for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-                    rowWidth += m_columnWidth[col];
+        case Alignment::UpperLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Up:
+            cellPosition.x += padding.getLeft() + (((cellSize.x - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::UpperRight:
+            cellPosition.x += cellSize.x - padding.getRight() - widgetSize.x;
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Right:
+            cellPosition.x += cellSize.x - padding.getRight() - widgetSize.x;
+            cellPosition.y += padding.getTop() + (((cellSize.y - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+
+        case Alignment::BottomRight:
+            cellPosition.x += cellSize.x - padding.getRight() - widgetSize.x;
+            cellPosition.y += cellSize.y - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::Bottom:
+            cellPosition.x += padding.getLeft() + (((cellSize.x - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += cellSize.y - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::BottomLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += cellSize.y - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::Left:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop() + (((cellSize.y - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+
+        case Alignment::Center:
+            cellPosition.x += padding.getLeft() + (((cellSize.x - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += padding.getTop() + (((cellSize.y - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+        }
 
-                size.x = std::max(size.x, rowWidth);
-                size.y += m_rowHeight[row];
-            }
+        // Don't trigger the PositionChanged signal when the widget didn't actually move
+        if (cell.widget->getPosition() != cellPosition)
+            cell.widget->setPosition(cellPosition);
+    }
 
-            Container::setSize(size);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Grid::getExtraOffset() const
+    {
+        Vector2f extraOffset;
+        if (!m_autoSize)
+        {
+            const Vector2f minimumSize = getMinimumSize();
+            if ((m_columnWidth.size() > 1) && (getSize().x > minimumSize.x))
+                extraOffset.x = (getSize().x - minimumSize.x) / (m_columnWidth.size() - 1);
+            if ((m_rowHeight.size() > 1) && (getSize().y > minimumSize.y))
+                extraOffset.y = (getSize().y - minimumSize.y) / (m_rowHeight.size() - 1);
         }
 
-        updatePositionsOfAllWidgets();
+        return extraOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<Grid::CellIndex, Grid::Cell>::const_iterator Grid::findCell(const Widget* widget) const
+    {
+        const auto indexIt = m_widgetCells.find(widget);
+        if (indexIt != m_widgetCells.end())
+            return m_cells.find(indexIt->second);
+        else
+            return m_cells.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<Grid::CellIndex, Grid::Cell>::iterator Grid::findCell(const Widget* widget)
+    {
+        const auto indexIt = m_widgetCells.find(widget);
+        if (indexIt != m_widgetCells.end())
+            return m_cells.find(indexIt->second);
+        else
+            return m_cells.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::copyCells(const Grid& other)
+    {
+        // The container copied the widgets in the same order, so the index can be used to find the copied widget
+        std::map<const Widget*, std::size_t> widgetIndices;
+        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
+            widgetIndices[other.m_widgets[i].get()] = i;
+
+        for (const auto& pair : other.m_cells)
+        {
+            const auto indexIt = widgetIndices.find(pair.second.widget.get());
+            if (indexIt == widgetIndices.end())
+                continue;
+
+            Cell cell = pair.second;
+            cell.widget = m_widgets[indexIt->second];
+            insertCell(pair.first, std::move(cell));
+        }
+
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::reconnectCells()
+    {
+        for (auto& pair : m_cells)
+        {
+            const Widget* widget = pair.second.widget.get();
+            pair.second.widget->disconnect(pair.second.sizeChangedCallbackId);
+            pair.second.sizeChangedCallbackId = pair.second.widget->connect("SizeChanged", [this, widget](){ widgetSizeChanged(widget); });
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -776,16 +1093,10 @@ namespace tgui
         states.transform.translate(getPosition());
 
         // Draw all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        for (const auto& pair : m_cells)
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() != nullptr)
-                {
-                    if (m_gridWidgets[row][col]->isVisible())
-                        m_gridWidgets[row][col]->draw(target, states);
-                }
-            }
+            if (pair.second.widget->isVisible())
+                pair.second.widget->draw(target, states);
         }
     }
 
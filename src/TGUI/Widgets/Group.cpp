@@ -143,12 +143,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const std::string& property)
+    void Group::rendererChanged(PropertyId property)
     {
-        if (property == "padding")
+        if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
         else
             Container::rendererChanged(property);
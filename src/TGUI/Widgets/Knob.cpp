@@ -461,50 +461,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Knob::getSignal(std::string signalName)
+    Signal& Knob::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const SignalTable<Knob> signals{*this, &Knob::onValueChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const std::string& property)
+    void Knob::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "textureforeground")
+        else if (property == PropertyId::TextureForeground)
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "imagerotation")
+        else if (property == PropertyId::ImageRotation)
         {
             m_imageRotationCached = getSharedRenderer()->getImageRotation();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -270,55 +270,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Label::getSignal(std::string signalName)
+    Signal& Label::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const SignalTable<Label> signals{*this, &Label::onDoubleClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const std::string& property)
+    void Label::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
-            rearrangeText();
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
+            requestGeometryUpdate();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
+            requestGeometryUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             for (auto& line : m_lines)
                 line.setColor(m_textColorCached);
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
-            rearrangeText();
+            requestGeometryUpdate();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -331,6 +332,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateGeometry()
+    {
+        rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> Label::save(SavingRenderersMap& renderers) const
     {
         auto node = Widget::save(renderers);
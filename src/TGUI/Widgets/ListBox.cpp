@@ -642,59 +642,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ListBox::getSignal(std::string signalName)
+    Signal& ListBox::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const SignalTable<ListBox> signals{*this, &ListBox::onItemSelect, &ListBox::onMousePress, &ListBox::onMouseRelease, &ListBox::onDoubleClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const std::string& property)
+    void ListBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "textcolorhover")
+        else if (property == PropertyId::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == PropertyId::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -704,7 +699,7 @@ namespace tgui
             if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
                 m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
         }
-        else if (property == "selectedtextstyle")
+        else if (property == PropertyId::SelectedTextStyle)
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
 
@@ -716,37 +711,37 @@ namespace tgui
                     m_items[m_selectedItem].setStyle(m_textStyleCached);
             }
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::ScrollbarProperty)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == PropertyId::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -755,7 +750,7 @@ namespace tgui
             for (auto& item : m_items)
                 item.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
@@ -727,64 +727,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& MenuBar::getSignal(std::string signalName)
+    Signal& MenuBar::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onMenuItemClick.getName()))
-            return onMenuItemClick;
+        static const SignalTable<MenuBar> signals{*this, &MenuBar::onMenuItemClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const std::string& property)
+    void MenuBar::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "textcolordisabled")
+        else if (property == PropertyId::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textureitembackground")
+        else if (property == PropertyId::TextureItemBackground)
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
         }
-        else if (property == "textureselecteditembackground")
+        else if (property == PropertyId::TextureSelectedItemBackground)
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
             updateTextOpacity(m_menus);
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
             updateTextFont(m_menus);
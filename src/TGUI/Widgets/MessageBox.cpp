@@ -293,29 +293,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& MessageBox::getSignal(std::string signalName)
+    Signal& MessageBox::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onButtonPress.getName()))
-            return onButtonPress;
+        static const SignalTable<MessageBox> signals{*this, &MessageBox::onButtonPress};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ChildWindow::getSignal(std::move(signalName));
+            return ChildWindow::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const std::string& property)
+    void MessageBox::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        if (property == PropertyId::TextColor)
         {
             m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "button")
+        else if (property == PropertyId::ButtonProperty)
         {
             const auto& renderer = getSharedRenderer()->getButton();
             for (auto& button : m_buttons)
                 button->setRenderer(renderer);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             ChildWindow::rendererChanged(property);
 
@@ -147,32 +147,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Panel::getSignal(std::string signalName)
-    {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
+    Signal& Panel::getSignal(const std::string& signalName)
+    {
+        static const SignalTable<Panel> signals{*this, &Panel::onMousePress, &Panel::onMouseRelease, &Panel::onClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Group::getSignal(std::move(signalName));
+            return Group::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Panel::rendererChanged(const std::string& property)
+    void Panel::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
@@ -165,19 +165,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Picture::getSignal(std::string signalName)
+    Signal& Picture::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const SignalTable<Picture> signals{*this, &Picture::onDoubleClick};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const std::string& property)
+    void Picture::rendererChanged(PropertyId property)
     {
-        if (property == "texture")
+        if (property == PropertyId::TextureProperty)
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
@@ -186,7 +187,7 @@ namespace tgui
 
             m_sprite.setTexture(texture);
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
             m_sprite.setOpacity(m_opacityCached);
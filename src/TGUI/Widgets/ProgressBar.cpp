@@ -289,26 +289,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ProgressBar::getSignal(std::string signalName)
+    Signal& ProgressBar::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else if (signalName == toLower(onFull.getName()))
-            return onFull;
+        static const SignalTable<ProgressBar> signals{*this, &ProgressBar::onValueChange, &ProgressBar::onFull};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const std::string& property)
+    void ProgressBar::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorFilled))
         {
             m_textBack.setColor(getSharedRenderer()->getTextColor());
 
@@ -317,33 +316,33 @@ namespace tgui
             else
                 m_textFront.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturefill")
+        else if (property == PropertyId::TextureFill)
         {
             m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
             recalculateFillSize();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             m_textBack.setStyle(getSharedRenderer()->getTextStyle());
             m_textFront.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "fillcolor")
+        else if (property == PropertyId::FillColor)
         {
             m_fillColorCached = getSharedRenderer()->getFillColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -353,7 +352,7 @@ namespace tgui
             m_textBack.setOpacity(m_opacityCached);
             m_textFront.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
@@ -273,32 +273,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& RadioButton::getSignal(std::string signalName)
+    Signal& RadioButton::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onCheck.getName()))
-            return onCheck;
-        else if (signalName == toLower(onUncheck.getName()))
-            return onUncheck;
+        static const SignalTable<RadioButton> signals{*this, &RadioButton::onCheck, &RadioButton::onUncheck};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const std::string& property)
+    void RadioButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             updateTextureSizes();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorHover) || (property == PropertyId::TextColorDisabled)
+              || (property == PropertyId::TextColorChecked) || (property == PropertyId::TextColorCheckedHover) || (property == PropertyId::TextColorCheckedDisabled))
         {
             updateTextColor();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyleProperty)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -307,7 +306,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textstylechecked")
+        else if (property == PropertyId::TextStyleChecked)
         {
             m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
@@ -316,113 +315,113 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textureunchecked")
+        else if (property == PropertyId::TextureUnchecked)
         {
             m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
             updateTextureSizes();
         }
-        else if (property == "texturechecked")
+        else if (property == PropertyId::TextureChecked)
         {
             m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
             updateTextureSizes();
         }
-        else if (property == "textureuncheckedhover")
+        else if (property == PropertyId::TextureUncheckedHover)
         {
             m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
         }
-        else if (property == "texturecheckedhover")
+        else if (property == PropertyId::TextureCheckedHover)
         {
             m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
         }
-        else if (property == "textureuncheckeddisabled")
+        else if (property == PropertyId::TextureUncheckedDisabled)
         {
             m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
         }
-        else if (property == "texturecheckeddisabled")
+        else if (property == PropertyId::TextureCheckedDisabled)
         {
             m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
         }
-        else if (property == "textureuncheckedfocused")
+        else if (property == PropertyId::TextureUncheckedFocused)
         {
             m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
         }
-        else if (property == "texturecheckedfocused")
+        else if (property == PropertyId::TextureCheckedFocused)
         {
             m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
         }
-        else if (property == "checkcolor")
+        else if (property == PropertyId::CheckColor)
         {
             m_checkColorCached = getSharedRenderer()->getCheckColor();
         }
-        else if (property == "checkcolorhover")
+        else if (property == PropertyId::CheckColorHover)
         {
             m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
         }
-        else if (property == "checkcolordisabled")
+        else if (property == PropertyId::CheckColorDisabled)
         {
             m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == PropertyId::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == PropertyId::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "bordercolorchecked")
+        else if (property == PropertyId::BorderColorChecked)
         {
             m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
         }
-        else if (property == "bordercolorcheckedhover")
+        else if (property == PropertyId::BorderColorCheckedHover)
         {
             m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
         }
-        else if (property == "bordercolorcheckeddisabled")
+        else if (property == PropertyId::BorderColorCheckedDisabled)
         {
             m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
         }
-        else if (property == "bordercolorcheckedfocused")
+        else if (property == PropertyId::BorderColorCheckedFocused)
         {
             m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorchecked")
+        else if (property == PropertyId::BackgroundColorChecked)
         {
             m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
         }
-        else if (property == "backgroundcolorcheckedhover")
+        else if (property == PropertyId::BackgroundColorCheckedHover)
         {
             m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
         }
-        else if (property == "backgroundcolorcheckeddisabled")
+        else if (property == PropertyId::BackgroundColorCheckedDisabled)
         {
             m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
         }
-        else if (property == "textdistanceratio")
+        else if (property == PropertyId::TextDistanceRatio)
         {
             m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -437,7 +436,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
@@ -483,24 +483,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& RangeSlider::getSignal(std::string signalName)
+    Signal& RangeSlider::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onRangeChange.getName()))
-            return onRangeChange;
+        static const SignalTable<RangeSlider> signals{*this, &RangeSlider::onRangeChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RangeSlider::rendererChanged(const std::string& property)
+    void RangeSlider::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturetrack")
+        else if (property == PropertyId::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -509,54 +510,54 @@ namespace tgui
             else
                 m_verticalImage = false;
 
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturetrackhover")
+        else if (property == PropertyId::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (property == PropertyId::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturethumbhover")
+        else if (property == PropertyId::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "trackcolor")
+        else if (property == PropertyId::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == "trackcolorhover")
+        else if (property == PropertyId::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == "selectedtrackcolor")
+        else if (property == PropertyId::SelectedTrackColor)
         {
             m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
         }
-        else if (property == "selectedtrackcolorhover")
+        else if (property == PropertyId::SelectedTrackColorHover)
         {
             m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "thumbcolorhover")
+        else if (property == PropertyId::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
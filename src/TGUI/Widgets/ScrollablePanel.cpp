@@ -569,14 +569,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const std::string& property)
+    void ScrollablePanel::rendererChanged(PropertyId property)
     {
-        if (property == "scrollbar")
+        if (property == PropertyId::ScrollbarProperty)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
@@ -733,19 +733,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Scrollbar::getSignal(std::string signalName)
+    Signal& Scrollbar::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const SignalTable<Scrollbar> signals{*this, &Scrollbar::onValueChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::rendererChanged(const std::string& property)
+    void Scrollbar::rendererChanged(PropertyId property)
     {
-        if (property == "texturetrack")
+        if (property == PropertyId::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
             if (m_sizeSet)
@@ -760,70 +761,70 @@ namespace tgui
                 m_sizeSet = false;
             }
         }
-        else if (property == "texturetrackhover")
+        else if (property == PropertyId::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (property == PropertyId::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             updateSize();
         }
-        else if (property == "texturethumbhover")
+        else if (property == PropertyId::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "texturearrowup")
+        else if (property == PropertyId::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
             updateSize();
         }
-        else if (property == "texturearrowuphover")
+        else if (property == PropertyId::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (property == PropertyId::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
             updateSize();
         }
-        else if (property == "texturearrowdownhover")
+        else if (property == PropertyId::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "trackcolor")
+        else if (property == PropertyId::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == "trackcolorhover")
+        else if (property == PropertyId::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "thumbcolorhover")
+        else if (property == PropertyId::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (property == PropertyId::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (property == PropertyId::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -455,24 +455,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Slider::getSignal(std::string signalName)
+    Signal& Slider::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const SignalTable<Slider> signals{*this, &Slider::onValueChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Slider::rendererChanged(const std::string& property)
+    void Slider::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturetrack")
+        else if (property == PropertyId::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -481,46 +482,46 @@ namespace tgui
             else
                 m_verticalImage = false;
 
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturetrackhover")
+        else if (property == PropertyId::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (property == PropertyId::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturethumbhover")
+        else if (property == PropertyId::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "trackcolor")
+        else if (property == PropertyId::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == "trackcolorhover")
+        else if (property == PropertyId::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "thumbcolorhover")
+        else if (property == PropertyId::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -303,65 +303,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& SpinButton::getSignal(std::string signalName)
+    Signal& SpinButton::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const SignalTable<SpinButton> signals{*this, &SpinButton::onValueChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return ClickableWidget::getSignal(std::move(signalName));
+            return ClickableWidget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButton::rendererChanged(const std::string& property)
+    void SpinButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "borderbetweenarrows")
+        else if (property == PropertyId::BorderBetweenArrows)
         {
             m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "texturearrowup")
+        else if (property == PropertyId::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
         }
-        else if (property == "texturearrowuphover")
+        else if (property == PropertyId::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (property == PropertyId::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
         }
-        else if (property == "texturearrowdownhover")
+        else if (property == PropertyId::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
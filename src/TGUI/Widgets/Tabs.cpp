@@ -553,98 +553,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Tabs::getSignal(std::string signalName)
+    Signal& Tabs::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onTabSelect.getName()))
-            return onTabSelect;
+        static const SignalTable<Tabs> signals{*this, &Tabs::onTabSelect};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const std::string& property)
+    void Tabs::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             recalculateTabsWidth();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors();
         }
-        else if (property == "textcolorhover")
+        else if (property == PropertyId::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors();
         }
-        else if (property == "textcolordisabled")
+        else if (property == PropertyId::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == PropertyId::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors();
         }
-        else if (property == "texturetab")
+        else if (property == PropertyId::TextureTab)
         {
             m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
         }
-        else if (property == "texturetabhover")
+        else if (property == PropertyId::TextureTabHover)
         {
             m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
         }
-        else if (property == "textureselectedtab")
+        else if (property == PropertyId::TextureSelectedTab)
         {
             m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
         }
-        else if (property == "textureselectedtabhover")
+        else if (property == PropertyId::TextureSelectedTabHover)
         {
             m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
         }
-        else if (property == "texturedisabledtab")
+        else if (property == PropertyId::TextureDisabledTab)
         {
             m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             recalculateTabsWidth();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == PropertyId::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -657,7 +658,7 @@ namespace tgui
             for (auto& tab : m_tabs)
                 tab.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
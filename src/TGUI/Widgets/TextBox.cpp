@@ -1452,74 +1452,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& TextBox::getSignal(std::string signalName)
+    Signal& TextBox::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
+        static const SignalTable<TextBox> signals{*this, &TextBox::onTextChange};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rendererChanged(const std::string& property)
+    void TextBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
             m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::ScrollbarProperty)
         {
             m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScroll->getDefaultWidth();
             m_verticalScroll->setSize({width, m_verticalScroll->getSize().y});
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == PropertyId::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "caretcolor")
+        else if (property == PropertyId::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretwidth")
+        else if (property == PropertyId::CaretWidth)
         {
             m_caretWidthCached = getSharedRenderer()->getCaretWidth();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -1531,7 +1532,7 @@ namespace tgui
             m_textSelection1.setOpacity(m_opacityCached);
             m_textSelection2.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::FontProperty)
         {
             Widget::rendererChanged(property);
 
@@ -762,99 +762,94 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& TreeView::getSignal(std::string signalName)
+    Signal& TreeView::getSignal(const std::string& signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else if (signalName == toLower(onExpand.getName()))
-            return onExpand;
-        else if (signalName == toLower(onCollapse.getName()))
-            return onCollapse;
+        static const SignalTable<TreeView> signals{*this, &TreeView::onItemSelect, &TreeView::onDoubleClick, &TreeView::onExpand, &TreeView::onCollapse};
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
-            return Widget::getSignal(std::move(signalName));
+            return Widget::getSignal(signalName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::rendererChanged(const std::string& property)
+    void TreeView::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::BordersProperty)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::PaddingProperty)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestGeometryUpdate();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == PropertyId::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "texturebranchexpanded")
+        else if (property == PropertyId::TextureBranchExpanded)
         {
             m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
             markNodesDirty();
         }
-        else if (property == "texturebranchcollapsed")
+        else if (property == PropertyId::TextureBranchCollapsed)
         {
             m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
             markNodesDirty();
         }
-        else if (property == "textureleaf")
+        else if (property == PropertyId::TextureLeaf)
         {
             m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
             markNodesDirty();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "textcolorhover")
+        else if (property == PropertyId::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == PropertyId::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::ScrollbarProperty)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
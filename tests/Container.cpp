@@ -265,6 +265,96 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Renderer statistics")
+    {
+        tgui::Gui gui;
+        auto panel1 = tgui::Panel::create();
+        auto panel2 = tgui::Panel::create();
+        auto panel3 = tgui::Panel::create();
+        gui.add(panel1);
+        gui.add(panel2);
+        panel2->add(panel3);
+
+        auto statistics = gui.getRendererStatistics();
+        REQUIRE(statistics.widgetCount == 3);
+        REQUIRE(statistics.rendererCount == 1);
+        REQUIRE(statistics.sharedBaseCount == 0);
+        REQUIRE(statistics.propertyCount == panel1->getSharedRenderer()->getPropertyValuePairs().size());
+        REQUIRE(statistics.observerCount >= 3);
+        REQUIRE(statistics.sharingRatio == 3);
+        REQUIRE(statistics.bytesUsed > 0);
+
+        panel3->getRenderer()->setBackgroundColor(sf::Color::Red);
+        statistics = gui.getRendererStatistics();
+        REQUIRE(statistics.widgetCount == 3);
+        REQUIRE(statistics.rendererCount == 2);
+        REQUIRE(statistics.sharedBaseCount == 1);
+        REQUIRE(statistics.sharingRatio == 1.5f);
+    }
+
+    SECTION("Delegated signals")
+    {
+        std::vector<tgui::Widget::Ptr> senders;
+        const unsigned int id = widget2->connectDelegated("PositionChanged", [&](tgui::Widget::Ptr sender, const std::string& signalName){
+                REQUIRE(signalName == "PositionChanged");
+                senders.push_back(sender);
+            });
+
+        unsigned int widgetHandlerCount = 0;
+        widget4->connect("PositionChanged", [&]{ REQUIRE(senders.empty()); widgetHandlerCount++; });
+
+        widget4->setPosition(10, 10);
+        widget5->setPosition(10, 10);
+        widget1->setPosition(10, 10);
+        widget2->setPosition(10, 10);
+        REQUIRE(widgetHandlerCount == 1);
+        REQUIRE(senders == std::vector<tgui::Widget::Ptr>{widget4, widget5});
+
+        // Widgets in child containers and widgets that are added later also bubble their signals
+        auto childPanel = tgui::Panel::create();
+        auto widget6 = tgui::Label::create();
+        widget2->add(childPanel);
+        childPanel->add(widget6);
+        widget6->setPosition(10, 10);
+        REQUIRE(senders.size() == 3);
+        REQUIRE(senders.back() == widget6);
+
+        // The signal name is case-insensitive and only matching signals are delegated
+        unsigned int sizeChangedCount = 0;
+        const unsigned int id2 = widget2->connectDelegated("sizechanged", [&](tgui::Widget::Ptr, const std::string&){ sizeChangedCount++; });
+        widget6->setSize(20, 20);
+        REQUIRE(sizeChangedCount == 1);
+        REQUIRE(senders.size() == 3);
+
+        REQUIRE(widget2->disconnectDelegated(id));
+        REQUIRE(!widget2->disconnectDelegated(id));
+        widget6->setPosition(20, 20);
+        REQUIRE(senders.size() == 3);
+
+        widget2->disconnectAllDelegated();
+        REQUIRE(!widget2->disconnectDelegated(id2));
+        widget6->setSize(30, 30);
+        REQUIRE(sizeChangedCount == 1);
+
+        // Delegated handlers are called for signals without handlers of their own, but don't mark the signal as handled
+        auto childWindow = tgui::ChildWindow::create();
+        widget2->add(childWindow);
+        unsigned int closedCount = 0;
+        widget2->connectDelegated("Closed", [&](tgui::Widget::Ptr, const std::string&){ closedCount++; });
+        REQUIRE(!childWindow->onClose.emit(childWindow.get()));
+        REQUIRE(closedCount == 1);
+
+        // Delegated handlers are queued together with the handlers of the signal
+        unsigned int queuedCount = 0;
+        widget2->connectDelegated("PositionChanged", [&](tgui::Widget::Ptr, const std::string&){ queuedCount++; });
+        widget6->onPositionChange.setDelivery(tgui::Signal::Delivery::Queued);
+        widget6->setPosition(40, 40);
+        REQUIRE(queuedCount == 0);
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(queuedCount == 1);
+        widget2->disconnectAllDelegated();
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <thread>
+
+TEST_CASE("[Gui]")
+{
+    tgui::Gui gui;
+
+    SECTION("post")
+    {
+        std::vector<int> executed;
+        gui.post([&]{ executed.push_back(1); });
+        gui.post([&]{
+                executed.push_back(2);
+
+                // Functions posted while executing the posted functions are only executed the next time
+                gui.post([&]{ executed.push_back(4); });
+            });
+        gui.post([&]{ executed.push_back(3); });
+        REQUIRE(executed.empty());
+
+        gui.runPostedTasks();
+        REQUIRE(executed == std::vector<int>{1, 2, 3});
+
+        gui.runPostedTasks();
+        REQUIRE(executed == std::vector<int>{1, 2, 3, 4});
+
+        gui.runPostedTasks();
+        REQUIRE(executed.size() == 4);
+    }
+
+    SECTION("Posted function throws")
+    {
+        std::vector<int> executed;
+        gui.post([&]{ executed.push_back(1); });
+        gui.post([&]{ throw tgui::Exception{"Posted function failed"}; });
+        gui.post([&]{ executed.push_back(2); });
+
+        // The functions behind the one that threw are executed the next time
+        REQUIRE_THROWS_AS(gui.runPostedTasks(), tgui::Exception);
+        REQUIRE(executed == std::vector<int>{1});
+
+        gui.post([&]{ executed.push_back(3); });
+        gui.runPostedTasks();
+        REQUIRE(executed == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Posted functions are executed when handling events")
+    {
+        sf::RenderTexture texture;
+        texture.create(20, 15);
+        tgui::Gui guiWithTarget{texture};
+
+        unsigned int count = 0;
+        guiWithTarget.post([&]{ count++; });
+
+        sf::Event event;
+        event.type = sf::Event::GainedFocus;
+        guiWithTarget.handleEvent(event);
+        REQUIRE(count == 1);
+    }
+
+    SECTION("postCoalesced")
+    {
+        std::vector<int> executed;
+        gui.postCoalesced(1, [&]{ executed.push_back(1); });
+        gui.postCoalesced(2, [&]{ executed.push_back(2); });
+        gui.post([&]{ executed.push_back(3); });
+        gui.postCoalesced(1, [&]{ executed.push_back(4); });
+        gui.runPostedTasks();
+        REQUIRE(executed == std::vector<int>{2, 3, 4});
+
+        gui.postCoalesced(1, [&]{ executed.push_back(5); });
+        gui.runPostedTasks();
+        REQUIRE(executed == std::vector<int>{2, 3, 4, 5});
+    }
+
+    SECTION("Posting from multiple threads")
+    {
+        const unsigned int threadCount = 4;
+        const unsigned int tasksPerThread = 1000;
+
+        unsigned int count = 0;
+        std::vector<unsigned int> lastValues(threadCount, 0);
+        bool ordered = true;
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&,i]{
+                for (unsigned int j = 1; j <= tasksPerThread; ++j)
+                {
+                    gui.post([&,i,j]{
+                        // Functions posted by the same thread are executed in order
+                        if (lastValues[i] + 1 != j)
+                            ordered = false;
+
+                        lastValues[i] = j;
+                        count++;
+                    });
+
+                    if (i == 0)
+                        gui.runPostedTasks();
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        gui.runPostedTasks();
+        REQUIRE(count == threadCount * tasksPerThread);
+        REQUIRE(ordered);
+    }
+}
@@ -346,6 +346,55 @@ TEST_CASE("[Layouts]")
                 REQUIRE(width.getValue() == 40);
                 REQUIRE(height.getValue() == 30);
                 REQUIRE(size.getValue() == sf::Vector2f(40, 30));
+
+                unsigned int sizeChangedCount = 0;
+                gui.getContainer()->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+                SECTION("Coalesce")
+                {
+                    gui.setResizePolicy(tgui::Gui::ResizePolicy::Coalesce);
+                    REQUIRE(gui.getResizePolicy() == tgui::Gui::ResizePolicy::Coalesce);
+
+                    gui.setView(sf::View{{0, 0, 60, 45}});
+                    gui.setView(sf::View{{0, 0, 80, 60}});
+                    REQUIRE(gui.getView().getSize() == sf::Vector2f(80, 60));
+                    REQUIRE(size.getValue() == sf::Vector2f(40, 30));
+                    REQUIRE(sizeChangedCount == 0);
+
+                    gui.draw();
+                    REQUIRE(size.getValue() == sf::Vector2f(80, 60));
+                    REQUIRE(sizeChangedCount == 1);
+
+                    gui.draw();
+                    REQUIRE(sizeChangedCount == 1);
+                }
+
+                SECTION("Throttle")
+                {
+                    gui.setResizePolicy(tgui::Gui::ResizePolicy::Throttle);
+                    gui.setResizeThrottleInterval(sf::seconds(3600));
+                    REQUIRE(gui.getResizeThrottleInterval() == sf::seconds(3600));
+
+                    gui.setView(sf::View{{0, 0, 60, 45}});
+                    gui.draw();
+                    REQUIRE(size.getValue() == sf::Vector2f(40, 30));
+
+                    gui.applyPendingResize();
+                    REQUIRE(size.getValue() == sf::Vector2f(60, 45));
+                    REQUIRE(sizeChangedCount == 1);
+                }
+
+                SECTION("Switching back to Immediate")
+                {
+                    gui.setResizePolicy(tgui::Gui::ResizePolicy::Coalesce);
+                    gui.setView(sf::View{{0, 0, 60, 45}});
+                    gui.setResizePolicy(tgui::Gui::ResizePolicy::Immediate);
+                    REQUIRE(size.getValue() == sf::Vector2f(60, 45));
+
+                    gui.setView(sf::View{{0, 0, 80, 60}});
+                    REQUIRE(size.getValue() == sf::Vector2f(80, 60));
+                    REQUIRE(sizeChangedCount == 2);
+                }
             }
         }
 
@@ -360,6 +409,204 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Dependency graph")
+    {
+        // Layout evaluations are only counted while profiling
+        tgui::Signal::setProfilingEnabled(true);
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(200, 100);
+
+        auto button1 = std::make_shared<tgui::Button>();
+        panel->add(button1, "b1");
+        button1->setSize({"&.w / 2", 30});
+
+        auto button2 = std::make_shared<tgui::Button>();
+        panel->add(button2, "b2");
+        button2->setPosition({"b1.right", 0});
+
+        panel->setSize(300, 100);
+        REQUIRE(button2->getPosition() == sf::Vector2f(150, 0));
+
+        tgui::LayoutGraph graph{*panel};
+        REQUIRE(graph.nodes.size() == 4);
+        REQUIRE(graph.edges.size() == 3);
+        REQUIRE(graph.getDepth() == 2);
+
+        const auto findNode = [&graph](const tgui::Widget::Ptr& widget, tgui::LayoutGraph::Property property){
+                for (std::size_t i = 0; i < graph.nodes.size(); ++i)
+                {
+                    if ((graph.nodes[i].widget == widget.get()) && (graph.nodes[i].property == property))
+                        return i;
+                }
+
+                FAIL("Node not found in layout graph");
+                return graph.nodes.size();
+            };
+
+        const auto& panelWidth = graph.nodes[findNode(panel, tgui::LayoutGraph::Property::Width)];
+        REQUIRE(panelWidth.widgetName == "Panel");
+        REQUIRE(panelWidth.depth == 0);
+        REQUIRE(panelWidth.evaluations == 0);
+
+        const auto& button1Width = graph.nodes[findNode(button1, tgui::LayoutGraph::Property::Width)];
+        REQUIRE(button1Width.widgetName == "b1");
+        REQUIRE(button1Width.expression == "&.w / 2");
+        REQUIRE(button1Width.value == 150);
+        REQUIRE(button1Width.depth == 1);
+        REQUIRE(button1Width.evaluations == 2);
+
+        const auto& button2Left = graph.nodes[findNode(button2, tgui::LayoutGraph::Property::Left)];
+        REQUIRE(button2Left.widgetName == "b2");
+        REQUIRE(button2Left.depth == 2);
+        REQUIRE(button2Left.evaluations == 2);
+
+        REQUIRE(graph.nodes[findNode(button1, tgui::LayoutGraph::Property::Left)].depth == 0);
+
+        const std::string dot = graph.toDot();
+        REQUIRE(dot.find("digraph") == 0);
+        REQUIRE(dot.find("b2.left = b1.left + b1.width") != std::string::npos);
+
+        button2->resetLayoutStatistics();
+        REQUIRE(tgui::LayoutGraph{*panel}.nodes[findNode(button2, tgui::LayoutGraph::Property::Left)].evaluations == 0);
+
+        SECTION("Gui")
+        {
+            sf::RenderTexture texture;
+            texture.create(20, 15);
+            tgui::Gui gui{texture};
+            gui.add(panel);
+            panel->setSize({"&.w", "&.h"});
+
+            REQUIRE(gui.getLayoutGraph(true).getDepth() == 3);
+
+            gui.setView(sf::View{{0, 0, 40, 30}});
+            REQUIRE(button2->getPosition() == sf::Vector2f(20, 0));
+
+            const auto guiGraph = gui.getLayoutGraph();
+            for (const auto& node : guiGraph.nodes)
+            {
+                if ((node.widget == button2.get()) && (node.property == tgui::LayoutGraph::Property::Left))
+                    REQUIRE(node.evaluations == 1);
+            }
+        }
+
+        tgui::Signal::setProfilingEnabled(false);
+        button2->resetLayoutStatistics();
+        panel->setSize(400, 100);
+        REQUIRE(tgui::LayoutGraph{*panel}.nodes[findNode(button2, tgui::LayoutGraph::Property::Left)].evaluations == 0);
+    }
+
+    SECTION("Cycles")
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(200, 100);
+
+        auto button2 = std::make_shared<tgui::Button>();
+        button2->setSize(80, 40);
+        panel->add(button2, "b2");
+
+        auto button1 = std::make_shared<tgui::Button>();
+        panel->add(button1, "b1");
+        button1->setSize({"b2.width", 30});
+        REQUIRE(button1->getSize() == sf::Vector2f(80, 30));
+
+        // The widget keeps its previous size when the binding is refused
+        REQUIRE_THROWS_AS(button2->setSize({"b1.w + 10", 40}), tgui::Exception);
+        REQUIRE(button2->getSize() == sf::Vector2f(80, 40));
+
+        REQUIRE_THROWS_AS(button2->setPosition({bindLeft(button2) + 10, 0}), tgui::Exception);
+        REQUIRE_NOTHROW(button2->setPosition({bindWidth(button2) + 10, 0}));
+
+        button1->setSize({"&.w", 30});
+        REQUIRE_THROWS_AS(panel->setSize({"b1.width", 100}), tgui::Exception);
+        REQUIRE(panel->getSize() == sf::Vector2f(200, 100));
+
+        // A widget whose layout would refer to itself in the new parent is not added and its other layouts stay unbound
+        auto button3 = std::make_shared<tgui::Button>();
+        button3->setPosition({"b2.x", 0});
+        button3->setSize({"b3.width + 10", 20});
+        REQUIRE_THROWS_AS(panel->add(button3, "b3"), tgui::Exception);
+        REQUIRE(panel->getWidgets().size() == 2);
+        REQUIRE(button3->getParent() == nullptr);
+        REQUIRE(button3->getPosition() == sf::Vector2f(0, 0));
+
+        button2->setPosition(15, 0);
+        REQUIRE(button3->getPosition() == sf::Vector2f(0, 0));
+
+        // The layouts are left untouched, so the widget can still be added with a name that doesn't create a cycle
+        REQUIRE_NOTHROW(panel->add(button3, "b4"));
+        REQUIRE(button3->getParent() == panel.get());
+        REQUIRE(button3->getPosition() == sf::Vector2f(15, 0));
+    }
+
+    SECTION("Copies of expressions")
+    {
+        SECTION("Bind functions")
+        {
+            auto button = std::make_shared<tgui::Button>();
+            button->setSize(40, 20);
+
+            Layout layout1 = bindWidth(button) * 2 + 10;
+            Layout layout2 = layout1;
+            Layout layout3;
+            layout3 = layout2;
+            REQUIRE(layout1.getValue() == 90);
+            REQUIRE(layout2.getValue() == 90);
+            REQUIRE(layout3.getValue() == 90);
+
+            button->setSize(50, 20);
+            REQUIRE(layout1.getValue() == 110);
+            REQUIRE(layout2.getValue() == 110);
+            REQUIRE(layout3.getValue() == 110);
+
+            button = nullptr;
+            REQUIRE(layout1.getValue() == 10);
+            REQUIRE(layout2.getValue() == 10);
+            REQUIRE(layout3.getValue() == 10);
+        }
+
+        SECTION("Strings")
+        {
+            const tgui::Layout2d layout{"&.w - 20", "b.bottom + 5"};
+
+            auto panel1 = std::make_shared<tgui::Panel>();
+            panel1->setSize(200, 100);
+            auto button1 = std::make_shared<tgui::Button>();
+            button1->setPosition(0, 10);
+            button1->setSize(40, 20);
+            panel1->add(button1, "b");
+
+            auto panel2 = std::make_shared<tgui::Panel>();
+            panel2->setSize(300, 150);
+            auto button2 = std::make_shared<tgui::Button>();
+            button2->setPosition(0, 20);
+            button2->setSize(40, 30);
+            panel2->add(button2, "b");
+
+            // Every copy binds the widgets in its own parent
+            auto widget1 = std::make_shared<tgui::Button>();
+            panel1->add(widget1);
+            widget1->setSize(layout);
+            auto widget2 = std::make_shared<tgui::Button>();
+            panel2->add(widget2);
+            widget2->setSize(layout);
+            REQUIRE(widget1->getSize() == sf::Vector2f(180, 35));
+            REQUIRE(widget2->getSize() == sf::Vector2f(280, 55));
+
+            button1->setSize(40, 50);
+            panel2->setSize(400, 150);
+            REQUIRE(widget1->getSize() == sf::Vector2f(180, 65));
+            REQUIRE(widget2->getSize() == sf::Vector2f(380, 55));
+
+            auto widget3 = tgui::Button::copy(widget1);
+            panel2->add(widget3);
+            REQUIRE(widget3->getSize() == sf::Vector2f(380, 55));
+            REQUIRE(widget3->getSizeLayout().x.toString() == "&.w - 20");
+            REQUIRE(widget3->getSizeLayout().y.toString() == layout.y.toString());
+        }
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -201,7 +201,8 @@ TEST_CASE("[Deserializer]")
         REQUIRE(rendererData->propertyValuePairs.size() == 3);
         REQUIRE(rendererData->propertyValuePairs["somecolor"].getString() == "Red");
         REQUIRE(rendererData->propertyValuePairs["textstyleproperty"].getString() == "StrikeThrough");
-        REQUIRE(rendererData->propertyValuePairs["nested"].getString() == "{\nnum = 5;\n}");
+        REQUIRE(rendererData->propertyValuePairs["nested"].getType() == Type::RendererData);
+        REQUIRE(rendererData->propertyValuePairs["nested"].getRenderer()->propertyValuePairs["num"].getNumber() == 5);
     }
 
     SECTION("custom deserialize function")
@@ -25,8 +25,10 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Renderers/ButtonRenderer.hpp>
+#include <TGUI/Renderers/ListBoxRenderer.hpp>
 
-// TODO: Reloading theme
+#include <fstream>
 
 TEST_CASE("[Theme]")
 {
@@ -61,6 +63,106 @@ TEST_CASE("[Theme]")
             tgui::Theme theme2("resources/Black.txt");
             REQUIRE_THROWS_AS(theme2.getRenderer("nonexistent_section"), tgui::Exception);
         }
+
+        SECTION("Asynchronous")
+        {
+            tgui::Theme theme;
+            auto label = tgui::Label::create();
+            label->setRenderer(theme.getRenderer("Label"));
+            theme.getRenderer("Button");
+
+            auto themeLoaded = theme.loadAsync("resources/Black.txt");
+            REQUIRE(theme.getPrimary() == "");
+            themeLoaded.wait();
+
+            REQUIRE_NOTHROW(theme.load("resources/Black.txt"));
+            REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color(190, 190, 190));
+            REQUIRE(tgui::ButtonRenderer(theme.getRenderer("Button")).getTexture().getData() != nullptr);
+
+            REQUIRE_THROWS_AS(theme.loadAsync("nonexistent_file"), tgui::Exception);
+        }
+
+        SECTION("Resolved values")
+        {
+            // Values of known properties are deserialized when loading the theme, but still remember their text
+            tgui::Theme theme("resources/Black.txt");
+            auto rendererData = theme.getRenderer("ListBox");
+            REQUIRE(rendererData->propertyValuePairs["textcolor"].getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(rendererData->propertyValuePairs["textcolor"].getString() == "rgb(190, 190, 190)");
+            REQUIRE(rendererData->propertyValuePairs["padding"].getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(tgui::ListBoxRenderer(rendererData).getTextColor() == sf::Color(190, 190, 190));
+
+            // Textures are created by the theme, the theme loader only caches their text
+            REQUIRE(rendererData->propertyValuePairs["texturebackground"].getType() == tgui::ObjectConverter::Type::Texture);
+            auto loader = std::make_shared<tgui::DefaultThemeLoader>();
+            REQUIRE(loader->loadProperties("resources/Black.txt", "ListBox")["texturebackground"].getType() == tgui::ObjectConverter::Type::String);
+
+            // Copies of the renderer share the values
+            auto copiedData = std::make_shared<tgui::RendererData>(*rendererData);
+            REQUIRE(rendererData->propertyValuePairs["textcolor"] == copiedData->propertyValuePairs["textcolor"]);
+            REQUIRE(rendererData->propertyValuePairs["texturebackground"] == copiedData->propertyValuePairs["texturebackground"]);
+
+            // The type of the value depends on the property id, not on the name, and unknown properties are kept as text
+            {
+                std::ofstream file{"ThemeResolvedValues.txt"};
+                file << "Label { Opacity = 0.5; TextStyle = Bold; ScrollbarWidth = 5; NonexistentColor = Red; CustomPadding = 2; }\n";
+            }
+
+            tgui::Theme typedTheme{"ThemeResolvedValues.txt"};
+            auto typedData = typedTheme.getRenderer("Label");
+            REQUIRE(typedData->propertyValuePairs["opacity"].getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(typedData->propertyValuePairs["textstyle"].getType() == tgui::ObjectConverter::Type::TextStyle);
+            REQUIRE(typedData->propertyValuePairs["scrollbarwidth"].getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(typedData->propertyValuePairs["nonexistentcolor"].getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(typedData->propertyValuePairs["custompadding"].getType() == tgui::ObjectConverter::Type::String);
+        }
+    }
+
+    SECTION("Hot reload")
+    {
+        {
+            std::ofstream file{"ThemeHotReload.txt"};
+            file << "Label { TextColor = Red; BackgroundColor = Blue; }\n"
+                 << "Button { TextColor = Red; }\n";
+        }
+
+        tgui::Theme theme{"ThemeHotReload.txt"};
+        REQUIRE(!theme.isHotReloadEnabled());
+        theme.setHotReloadEnabled(true);
+        REQUIRE(theme.isHotReloadEnabled());
+        REQUIRE(!theme.reloadIfChanged());
+
+        auto label = tgui::Label::create();
+        label->setRenderer(theme.getRenderer("Label"));
+        REQUIRE(label->getSharedRenderer()->getBackgroundColor() == sf::Color::Blue);
+
+        std::vector<std::vector<tgui::PropertyId>> labelChanges;
+        std::vector<std::vector<tgui::PropertyId>> buttonChanges;
+        tgui::WidgetRenderer(theme.getRenderer("Label")).subscribeBatched(&labelChanges, [&](const std::vector<tgui::PropertyId>& properties){ labelChanges.push_back(properties); });
+        tgui::WidgetRenderer(theme.getRenderer("Button")).subscribeBatched(&buttonChanges, [&](const std::vector<tgui::PropertyId>& properties){ buttonChanges.push_back(properties); });
+
+        {
+            std::ofstream file{"ThemeHotReload.txt"};
+            file << "Label { TextColor = Green; BackgroundColor = Blue; }\n"
+                 << "Button { TextColor = Red; }\n";
+        }
+
+        // Only the property that got a different value is reported
+        REQUIRE(theme.reloadIfChanged());
+        REQUIRE(labelChanges.size() == 1);
+        REQUIRE(labelChanges[0] == std::vector<tgui::PropertyId>{tgui::PropertyId::TextColor});
+        REQUIRE(buttonChanges.empty());
+        REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color::Green);
+        REQUIRE(label->getSharedRenderer()->getBackgroundColor() == sf::Color::Blue);
+
+        REQUIRE(!theme.reloadIfChanged());
+
+        theme.setHotReloadEnabled(false);
+        REQUIRE(!theme.isHotReloadEnabled());
+        REQUIRE(!theme.reloadIfChanged());
+
+        tgui::WidgetRenderer(theme.getRenderer("Label")).unsubscribe(&labelChanges);
+        tgui::WidgetRenderer(theme.getRenderer("Button")).unsubscribe(&buttonChanges);
     }
 
     SECTION("Adding and removing renderers")
@@ -35,6 +35,7 @@ namespace tgui
     struct DefaultThemeLoaderTest
     {
         static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_propertiesCache; }
+        static auto& getRenderersCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_renderersCache; }
     };
 }
 
@@ -108,53 +109,82 @@ TEST_CASE("[ThemeLoader]")
         properties = loader->load("resources/ThemeNested.txt", "ComboBox5");
         REQUIRE(properties.size() == 1);
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
+
+        // Nested sections and references are loaded as renderers that don't have to be parsed again
+        auto rendererProperties = loader->loadProperties("resources/ThemeNested.txt", "ComboBox4");
+        REQUIRE(rendererProperties.size() == 1);
+        REQUIRE(rendererProperties["listbox"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto listBoxRenderer = rendererProperties["listbox"].getRenderer();
+        REQUIRE(listBoxRenderer->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto scrollbarRenderer = listBoxRenderer->propertyValuePairs["scrollbar"].getRenderer();
+        REQUIRE(scrollbarRenderer->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(scrollbarRenderer->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        // Every call returns its own copy of the nested renderers
+        rendererProperties = loader->loadProperties("resources/ThemeNested.txt", "ListBox1");
+        REQUIRE(rendererProperties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(rendererProperties["scrollbar"].getRenderer() != scrollbarRenderer);
+        REQUIRE(rendererProperties["scrollbar"].getRenderer()->propertyValuePairs.size() == 2);
+
+        rendererProperties = loader->loadProperties("resources/ThemeNested.txt", "ListBox3");
+        REQUIRE(rendererProperties["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Yellow);
     }
 
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
+        REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader).size() == 0);
 
         SECTION("with preload")
         {
             loader->preload("resources/ThemeSpecialCases.txt");
             loader->preload("resources/ThemeButton1.txt");
 
+            // Preloading only parses the sections, their text form is created when they are loaded
             auto& propertyCache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader);
-            REQUIRE(propertyCache.size() == 2);
+            auto& rendererCache = tgui::DefaultThemeLoaderTest::getRenderersCache(loader);
+            REQUIRE(propertyCache.size() == 0);
+            REQUIRE(rendererCache.size() == 2);
 
-            auto& cache1 = propertyCache["resources/ThemeSpecialCases.txt"];
-            auto& cache2 = propertyCache["resources/ThemeButton1.txt"];
+            auto& cache1 = rendererCache["resources/ThemeSpecialCases.txt"];
+            auto& cache2 = rendererCache["resources/ThemeButton1.txt"];
             REQUIRE(cache1.size() == 4);
             REQUIRE(cache1["button1"].size() == 1);
-            REQUIRE(cache1["button1"]["textcolor"] == "rgb(255, 0, 0)");
+            REQUIRE(cache1["button1"]["textcolor"].getString() == "rgb(255, 0, 0)");
             REQUIRE(cache1["name.with.dots"].size() == 2);
-            REQUIRE(cache1["name.with.dots"]["textcolor"] == "rgb(0, 255, 0)");
-            REQUIRE(cache1["name.with.dots"]["backgroundcolor"] == "rgb(255, 255, 255)");
+            REQUIRE(cache1["name.with.dots"]["textcolor"].getString() == "rgb(0, 255, 0)");
+            REQUIRE(cache1["name.with.dots"]["backgroundcolor"].getString() == "rgb(255, 255, 255)");
             REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""].size() == 1);
-            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]["textcolor"] == "rgba(,,,)");
+            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]["textcolor"].getString() == "rgba(,,,)");
             REQUIRE(cache1["label"].size() == 1);
-            REQUIRE(cache1["label"]["textcolor"] == "rgb(0, 0, 255)");
+            REQUIRE(cache1["label"]["textcolor"].getString() == "rgb(0, 0, 255)");
             REQUIRE(cache2.size() == 1);
             REQUIRE(cache2["button1"].size() == 1);
-            REQUIRE(cache2["button1"]["textcolor"] == "rgb(255, 255, 0)");
+            REQUIRE(cache2["button1"]["textcolor"].getString() == "rgb(255, 255, 0)");
 
             auto properties = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots");
             REQUIRE(properties.size() == 2);
             REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(propertyCache.size() == 2);
+            REQUIRE(propertyCache.size() == 1);
+            REQUIRE(propertyCache["resources/ThemeSpecialCases.txt"].size() == 1);
 
             properties = loader->load("resources/ThemeButton1.txt", "Button1");
             REQUIRE(propertyCache.size() == 2);
+            REQUIRE(rendererCache.size() == 2);
 
             properties = loader->load("resources/Black.txt", "EditBox");
             REQUIRE(propertyCache.size() == 3);
+            REQUIRE(rendererCache.size() == 3);
 
             tgui::DefaultThemeLoader::flushCache("resources/ThemeButton1.txt");
             REQUIRE(propertyCache.size() == 2);
+            REQUIRE(rendererCache.size() == 2);
 
             tgui::DefaultThemeLoader::flushCache();
             REQUIRE(propertyCache.size() == 0);
+            REQUIRE(rendererCache.size() == 0);
         }
 
         SECTION("without preload")
@@ -164,18 +194,19 @@ TEST_CASE("[ThemeLoader]")
             REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 1);
+            REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader).size() == 1);
+            REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader)["resources/ThemeSpecialCases.txt"].size() == 4);
+
+            REQUIRE(loader->load("resources/ThemeSpecialCases.txt", "Button1").at("textcolor") == "rgb(255, 0, 0)");
+            REQUIRE(loader->load("resources/ThemeSpecialCases.txt", "Label").at("textcolor") == "rgb(0, 0, 255)");
+            REQUIRE(loader->load("resources/ThemeSpecialCases.txt", "SpecialChars.{}=:;/*#//\t\\\"").at("textcolor") == "rgba(,,,)");
 
             auto& cache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader)["resources/ThemeSpecialCases.txt"];
             REQUIRE(cache.size() == 4);
             REQUIRE(cache["button1"].size() == 1);
-            REQUIRE(cache["button1"]["textcolor"] == "rgb(255, 0, 0)");
             REQUIRE(cache["name.with.dots"].size() == 2);
-            REQUIRE(cache["name.with.dots"]["textcolor"] == "rgb(0, 255, 0)");
-            REQUIRE(cache["name.with.dots"]["backgroundcolor"] == "rgb(255, 255, 255)");
             REQUIRE(cache["specialchars.{}=:;/*#//\t\\\""].size() == 1);
-            REQUIRE(cache["specialchars.{}=:;/*#//\t\\\""]["textcolor"] == "rgba(,,,)");
             REQUIRE(cache["label"].size() == 1);
-            REQUIRE(cache["label"]["textcolor"] == "rgb(0, 0, 255)");
 
             properties = loader->load("resources/Black.txt", "EditBox");
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 2);
@@ -188,5 +219,62 @@ TEST_CASE("[ThemeLoader]")
             tgui::DefaultThemeLoader::flushCache();
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
         }
+
+        SECTION("nested sections")
+        {
+            // The text of nested sections and references is created from the parsed renderers
+            const auto& properties = loader->load("resources/ThemeNested.txt", "ListBox1");
+            REQUIRE(properties.size() == 2);
+            REQUIRE(properties.at("scrollbar").find("{") == 0);
+
+            auto scrollbarRenderer = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::RendererData, properties.at("scrollbar")).getRenderer();
+            REQUIRE(scrollbarRenderer->propertyValuePairs.size() == 2);
+            REQUIRE(scrollbarRenderer->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        }
+    }
+
+    SECTION("binary theme")
+    {
+        auto binaryLoader = std::make_shared<tgui::BinaryThemeLoader>();
+
+        REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/ThemeSpecialCases.txt", "ThemeSpecialCases.bin"));
+        REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/Black.txt", "Black.bin"));
+
+        REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/ThemeNested.txt", "ThemeNested.bin"));
+
+        auto& rendererCache = tgui::DefaultThemeLoaderTest::getRenderersCache(binaryLoader);
+        binaryLoader->preload("ThemeSpecialCases.bin");
+        binaryLoader->preload("Black.bin");
+
+        // Sections are only decoded when they are loaded
+        REQUIRE(rendererCache["Black.bin"].empty());
+        REQUIRE(binaryLoader->canLoad("Black.bin", "EditBox"));
+        REQUIRE(!binaryLoader->canLoad("Black.bin", "NonexistentClassName"));
+        REQUIRE(rendererCache["Black.bin"].empty());
+
+        auto textLoader = std::make_shared<tgui::DefaultThemeLoader>();
+        for (const auto& section : rendererCache["resources/Black.txt"])
+            REQUIRE(binaryLoader->load("Black.bin", section.first) == textLoader->load("resources/Black.txt", section.first));
+        REQUIRE(rendererCache["Black.bin"].size() == rendererCache["resources/Black.txt"].size());
+
+        // Nested sections and references are stored as sections instead of as text
+        auto rendererProperties = binaryLoader->loadProperties("ThemeNested.bin", "ComboBox4");
+        REQUIRE(rendererProperties["listbox"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto listBoxRenderer = rendererProperties["listbox"].getRenderer();
+        REQUIRE(listBoxRenderer->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(binaryLoader->loadProperties("ThemeNested.bin", "ListBox3")["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Yellow);
+
+        auto properties = binaryLoader->load("ThemeSpecialCases.bin", "name.WITH.dots");
+        REQUIRE(properties.size() == 2);
+        REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
+        REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
+        REQUIRE_THROWS_AS(binaryLoader->load("Black.bin", "NonexistentClassName"), tgui::Exception);
+
+        // Text themes can still be loaded
+        REQUIRE(binaryLoader->load("resources/ThemeButton1.txt", "Button1").size() == 1);
+
+        REQUIRE_THROWS_AS(binaryLoader->load("resources/nonexistent.bin", ""), tgui::Exception);
     }
 }
@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <algorithm>
+#include <thread>
 
 TEST_CASE("[Signal]")
 {
@@ -63,6 +66,8 @@ TEST_CASE("[Signal]")
         REQUIRE(widget->connect("AnimationFinished", [](tgui::ShowAnimationType, bool){}) == ++id);
 
         REQUIRE_THROWS_AS(widget->connect("SomeInvalidSignal", [](){}), tgui::Exception);
+        REQUIRE_THROWS_AS(widget->connect("PositionChanged", [](int){}), tgui::Exception);
+        REQUIRE_THROWS_AS(widget->connect("AnimationFinished", [](bool, tgui::ShowAnimationType){}), tgui::Exception);
 
         tgui::Widget::Ptr widget2 = tgui::Button::create();
         REQUIRE(widget2->connect("Pressed", [](){}) == ++id);
@@ -110,6 +115,371 @@ TEST_CASE("[Signal]")
         REQUIRE(widget2->connect("Pressed", std::function<void(std::string)>([](std::string){})) == ++id);
     }
 
+    SECTION("Changing handlers while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        unsigned int id2 = 0;
+        widget->connect("PositionChanged", [&]{
+                count1++;
+                if (count1 == 1)
+                {
+                    // Handlers that are disconnected or connected during the emit only take effect during the next emit
+                    widget->disconnect(id2);
+                    widget->connect("PositionChanged", [&]{ count3++; });
+                }
+            });
+        id2 = widget->connect("PositionChanged", [&]{ count2++; });
+
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 1);
+        REQUIRE(count3 == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 2);
+        REQUIRE(count2 == 1);
+        REQUIRE(count3 == 1);
+
+        // A handler may disconnect all handlers, including itself
+        widget->connect("SizeChanged", [&]{ count1++; widget->disconnectAll("SizeChanged"); });
+        widget->connect("SizeChanged", [&]{ count2++; });
+        widget->setSize(50, 20);
+        widget->setSize(60, 20);
+        REQUIRE(count1 == 3);
+        REQUIRE(count2 == 2);
+    }
+
+    SECTION("Connecting to signal objects")
+    {
+        sf::Vector2f size;
+        unsigned int count = 0;
+        unsigned int id = widget->connect(widget->onSizeChange, [&](tgui::Vector2f newSize){ size = newSize; });
+        REQUIRE(widget->connect(widget->onSizeChange, [&](tgui::Widget::Ptr w, std::string signalName, sf::Vector2f){
+                REQUIRE(w == widget);
+                REQUIRE(signalName == "SizeChanged");
+                count++;
+            }) == ++id);
+        REQUIRE(widget->connect(widget->onSizeChange, [&](unsigned int& c){ c++; }, std::ref(count)) == ++id);
+
+        widget->setSize(40, 30);
+        REQUIRE(size == sf::Vector2f(40, 30));
+        REQUIRE(count == 2);
+
+        REQUIRE(widget->disconnect(id));
+        widget->setSize(50, 20);
+        REQUIRE(count == 3);
+
+        bool animationFinishedVisible = false;
+        widget->connect(widget->onAnimationFinished, [&](bool visible){ animationFinishedVisible = visible; });
+        widget->onAnimationFinished.emit(widget.get(), tgui::ShowAnimationType::Fade, true);
+        REQUIRE(animationFinishedVisible);
+
+        auto button = tgui::Button::create();
+        button->setText("Text");
+        std::string text;
+        button->connect(button->onPress, [&](std::string str){ text = str; });
+        button->onPress.emit(button.get(), button->getText());
+        REQUIRE(text == "Text");
+    }
+
+    SECTION("Emitting from signal handler")
+    {
+        // The parameters of the outer emit must not be overwritten by the signal emitted inside the handler
+        sf::Vector2f size;
+        widget->connect("SizeChanged", [&]{ widget->setPosition(100, 200); });
+        widget->connect("SizeChanged", [&](sf::Vector2f newSize){ size = newSize; });
+
+        widget->setSize(40, 30);
+        REQUIRE(size == sf::Vector2f(40, 30));
+        REQUIRE(widget->getPosition() == sf::Vector2f(100, 200));
+    }
+
+    SECTION("Queued delivery")
+    {
+        std::vector<sf::Vector2f> sizes;
+        widget->connect("SizeChanged", [&](sf::Vector2f size){ sizes.push_back(size); });
+
+        widget->onSizeChange.setDelivery(tgui::Signal::Delivery::Queued);
+        REQUIRE(widget->onSizeChange.getDelivery() == tgui::Signal::Delivery::Queued);
+        widget->setSize(10, 20);
+        widget->setSize(30, 40);
+        REQUIRE(sizes.empty());
+
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(sizes.size() == 2);
+        REQUIRE(sizes[0] == sf::Vector2f(10, 20));
+        REQUIRE(sizes[1] == sf::Vector2f(30, 40));
+
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(sizes.size() == 2);
+
+        sizes.clear();
+        widget->onSizeChange.setDelivery(tgui::Signal::Delivery::QueuedLatest);
+        widget->setSize(50, 60);
+        widget->setSize(70, 80);
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(sizes.size() == 1);
+        REQUIRE(sizes[0] == sf::Vector2f(70, 80));
+
+        sizes.clear();
+        widget->onSizeChange.setDelivery(tgui::Signal::Delivery::Immediate);
+        widget->setSize(90, 100);
+        REQUIRE(sizes.size() == 1);
+
+        // Queued signals of widgets that no longer exist are not delivered
+        unsigned int count = 0;
+        auto widget2 = tgui::ClickableWidget::create();
+        widget2->connect("PositionChanged", [&]{ count++; });
+        widget2->onPositionChange.setDelivery(tgui::Signal::Delivery::Queued);
+        widget2->setPosition(10, 10);
+        widget2 = nullptr;
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(count == 0);
+
+        // Every gui only dispatches the queued signals of its own widgets
+        tgui::Gui gui1;
+        tgui::Gui gui2;
+        auto widget3 = tgui::ClickableWidget::create();
+        auto widget4 = tgui::ClickableWidget::create();
+        gui1.add(widget3);
+        gui2.add(widget4);
+
+        unsigned int count3 = 0;
+        unsigned int count4 = 0;
+        widget3->connect("PositionChanged", [&]{ count3++; });
+        widget4->connect("PositionChanged", [&]{ count4++; });
+        widget3->onPositionChange.setDelivery(tgui::Signal::Delivery::QueuedLatest);
+        widget4->onPositionChange.setDelivery(tgui::Signal::Delivery::QueuedLatest);
+        widget3->setPosition(10, 10);
+        widget4->setPosition(10, 10);
+
+        tgui::Signal::dispatchQueuedEmits(gui1.getContainer().get());
+        REQUIRE(count3 == 1);
+        REQUIRE(count4 == 0);
+
+        widget4->setPosition(20, 20);
+        tgui::Signal::dispatchQueuedEmits(gui2.getContainer().get());
+        REQUIRE(count3 == 1);
+        REQUIRE(count4 == 1);
+
+        // Signals that were emitted before the widget was added to the gui are dispatched by that gui
+        unsigned int count5 = 0;
+        auto widget5 = tgui::ClickableWidget::create();
+        widget5->connect("PositionChanged", [&]{ count5++; });
+        widget5->onPositionChange.setDelivery(tgui::Signal::Delivery::Queued);
+        widget5->setPosition(10, 10);
+        gui1.add(widget5);
+        tgui::Signal::dispatchQueuedEmits(gui1.getContainer().get());
+        REQUIRE(count5 == 1);
+    }
+
+    SECTION("Profiling")
+    {
+        tgui::Gui gui;
+        auto button = tgui::Button::create();
+        gui.add(button, "Btn, \"1\"");
+        gui.add(widget);
+
+        unsigned int count = 0;
+        button->connect("SizeChanged", [&]{ count++; });
+        button->connect("SizeChanged", [&]{ count++; });
+
+        // Nothing is recorded until profiling is enabled
+        button->setSize(10, 10);
+        REQUIRE(gui.getSignalProfile().entries.empty());
+
+        REQUIRE(!tgui::Signal::isProfilingEnabled());
+        tgui::Signal::setProfilingEnabled(true);
+        REQUIRE(tgui::Signal::isProfilingEnabled());
+        button->setSize(20, 20);
+        button->setSize(30, 30);
+        widget->setPosition(5, 5);
+        tgui::Signal::setProfilingEnabled(false);
+        button->setSize(40, 40);
+        REQUIRE(count == 8);
+
+        const auto profile = gui.getSignalProfile(true);
+        REQUIRE(profile.entries.size() == 2);
+
+        const auto& buttonEntry = (profile.entries[0].widget == button.get()) ? profile.entries[0] : profile.entries[1];
+        REQUIRE(buttonEntry.widgetName == "Btn, \"1\"");
+        REQUIRE(buttonEntry.signalName == "SizeChanged");
+        REQUIRE(buttonEntry.emits == 2);
+        REQUIRE(buttonEntry.handlerCalls == 4);
+
+        const auto& widgetEntry = (profile.entries[0].widget == widget.get()) ? profile.entries[0] : profile.entries[1];
+        REQUIRE(widgetEntry.widgetName == "ClickableWidget");
+        REQUIRE(widgetEntry.signalName == "PositionChanged");
+        REQUIRE(widgetEntry.emits == 1);
+        REQUIRE(widgetEntry.handlerCalls == 0);
+
+        REQUIRE(profile.toCsv().find("\"Btn, \"\"1\"\"\",SizeChanged,2,4,") != std::string::npos);
+        REQUIRE(profile.toJson().find("{\"widget\": \"ClickableWidget\", \"signal\": \"PositionChanged\", \"emits\": 1, \"handlerCalls\": 0, ") != std::string::npos);
+
+        // The statistics were reset when retrieving the profile
+        REQUIRE(gui.getSignalProfile().entries.empty());
+        REQUIRE(gui.getSignalProfile().toJson() == "[]\n");
+    }
+
+    SECTION("Scoped connections")
+    {
+        unsigned int count = 0;
+        {
+            tgui::ScopedConnection connection{widget, widget->connect("PositionChanged", [&]{ count++; })};
+            REQUIRE(connection.getId() != 0);
+            widget->setPosition(10, 10);
+            REQUIRE(count == 1);
+
+            tgui::ScopedConnection connection2 = std::move(connection);
+            REQUIRE(connection.getId() == 0);
+            widget->setPosition(20, 20);
+            REQUIRE(count == 2);
+        }
+
+        widget->setPosition(30, 30);
+        REQUIRE(count == 2);
+
+        tgui::ScopedConnection connection{widget, widget->connect("PositionChanged", [&]{ count++; })};
+        const unsigned int id = connection.release();
+        REQUIRE(connection.getId() == 0);
+        widget->setPosition(40, 40);
+        REQUIRE(count == 3);
+        REQUIRE(widget->disconnect(id));
+
+        // The connection may outlive the widget
+        auto widget2 = tgui::ClickableWidget::create();
+        connection = tgui::ScopedConnection{widget2, widget2->connect("PositionChanged", [&]{ count++; })};
+        widget2 = nullptr;
+        connection.disconnect();
+        REQUIRE(connection.getId() == 0);
+    }
+
+    SECTION("Weak receivers")
+    {
+        struct Receiver
+        {
+            void handler(sf::Vector2f newPos) { pos = newPos; count++; }
+            void handlerWithBoundArg(int value) { count += value; }
+
+            sf::Vector2f pos;
+            unsigned int count = 0;
+        };
+
+        auto receiver = std::make_shared<Receiver>();
+        const unsigned int id1 = widget->connectWeak("PositionChanged", receiver, &Receiver::handler);
+        const unsigned int id2 = widget->connectWeak("PositionChanged", std::weak_ptr<Receiver>(receiver), &Receiver::handlerWithBoundArg, 10);
+
+        unsigned int lambdaCount = 0;
+        const unsigned int id3 = widget->connectWeak("PositionChanged", receiver, [&]{ lambdaCount++; });
+
+        widget->setPosition(10, 20);
+        REQUIRE(receiver->pos == sf::Vector2f(10, 20));
+        REQUIRE(receiver->count == 11);
+        REQUIRE(lambdaCount == 1);
+
+        // The connections don't keep the receiver alive and are removed when emitting after the receiver was destroyed
+        std::weak_ptr<Receiver> weakReceiver = receiver;
+        receiver = nullptr;
+        REQUIRE(weakReceiver.expired());
+
+        widget->setPosition(30, 40);
+        REQUIRE(lambdaCount == 1);
+        REQUIRE(!widget->disconnect(id1));
+        REQUIRE(!widget->disconnect(id2));
+        REQUIRE(!widget->disconnect(id3));
+    }
+
+    SECTION("Connecting to multiple widgets")
+    {
+        auto panel = tgui::Panel::create();
+        auto childPanel = tgui::Panel::create();
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        panel->add(button1);
+        panel->add(widget);
+        panel->add(childPanel);
+        childPanel->add(button2);
+
+        std::vector<tgui::Widget::Ptr> movedWidgets;
+        sf::Vector2f lastPos;
+        const auto ids = tgui::Widget::connectAll(std::vector<tgui::Widget::Ptr>{button1, widget, childPanel}, "PositionChanged",
+                                                  [&](tgui::Widget::Ptr w, std::string, sf::Vector2f pos){ movedWidgets.push_back(w); lastPos = pos; });
+        REQUIRE(ids.size() == 3);
+
+        button1->setPosition(10, 20);
+        widget->setPosition(30, 40);
+        childPanel->setPosition(50, 60);
+        button2->setPosition(70, 80);
+        REQUIRE(movedWidgets == std::vector<tgui::Widget::Ptr>{button1, widget, childPanel});
+        REQUIRE(lastPos == sf::Vector2f(50, 60));
+
+        REQUIRE(widget->disconnect(ids[1]));
+        REQUIRE(!childPanel->disconnect(ids[1]));
+        widget->setPosition(0, 0);
+        REQUIRE(movedWidgets.size() == 3);
+
+        // The handler is bound again for widgets that have a different signal type with the same name
+        unsigned int pressCount = 0;
+        REQUIRE(tgui::Widget::connectAll(std::vector<tgui::Widget::Ptr>{button1, widget}, "Pressed", [&]{ pressCount++; }).size() == 2);
+        REQUIRE_THROWS_AS(tgui::Widget::connectAll(std::vector<tgui::Widget::Ptr>{button1}, "Pressed", [](int){}), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::Widget::connectAll(std::vector<tgui::Widget::Ptr>{childPanel}, "Pressed", []{}), tgui::Exception);
+
+        unsigned int buttonPressCount = 0;
+        REQUIRE(panel->connectToDescendants<tgui::Button>("Pressed", [&]{ buttonPressCount++; }).size() == 2);
+        REQUIRE(panel->connectToDescendants("SizeChanged", []{}).size() == 4);
+
+        button2->onPress.emit(button2.get(), "");
+        REQUIRE(buttonPressCount == 1);
+        REQUIRE(pressCount == 0);
+    }
+
+    SECTION("Multiple threads")
+    {
+        // Catch can't be used inside the threads, so the results are only checked after the threads have finished
+        struct ThreadResult
+        {
+            tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+            std::vector<unsigned int> ids;
+            unsigned int handlerCalls = 0;
+        };
+
+        const auto connectAndEmit = [](ThreadResult& result){
+                result.widget->onPositionChange.setDelivery(tgui::Signal::Delivery::Queued);
+                for (unsigned int i = 0; i < 1000; ++i)
+                    result.ids.push_back(result.widget->connect("PositionChanged", [&result]{ result.handlerCalls++; }));
+
+                result.widget->setPosition(10, 10);
+                tgui::Signal::dispatchQueuedEmits();
+            };
+
+        ThreadResult result1;
+        ThreadResult result2;
+        std::thread thread1{connectAndEmit, std::ref(result1)};
+        std::thread thread2{connectAndEmit, std::ref(result2)};
+        thread1.join();
+        thread2.join();
+
+        REQUIRE(result1.handlerCalls == 1000);
+        REQUIRE(result2.handlerCalls == 1000);
+
+        std::vector<unsigned int> ids = result1.ids;
+        ids.insert(ids.end(), result2.ids.begin(), result2.ids.end());
+        std::sort(ids.begin(), ids.end());
+        REQUIRE(std::unique(ids.begin(), ids.end()) == ids.end());
+
+        // Every thread only dispatches the emits that were queued on that thread
+        unsigned int count = 0;
+        widget->onPositionChange.setDelivery(tgui::Signal::Delivery::Queued);
+        widget->connect("PositionChanged", [&]{ count++; });
+        widget->setPosition(10, 10);
+        std::thread{[]{ tgui::Signal::dispatchQueuedEmits(); }}.join();
+        REQUIRE(count == 0);
+        tgui::Signal::dispatchQueuedEmits();
+        REQUIRE(count == 1);
+    }
+
     SECTION("disconnect")
     {
         unsigned int i = 0;
@@ -117,7 +487,8 @@ TEST_CASE("[Signal]")
         widget->setPosition(10, 10);
         REQUIRE(i == 1);
 
-        widget->disconnect(id);
+        REQUIRE(widget->disconnect(id));
+        REQUIRE(!widget->disconnect(id));
         widget->setPosition(20, 20);
         REQUIRE(i == 1);
 
@@ -141,4 +512,48 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("Signal names")
+    {
+        auto button = tgui::Button::create();
+
+        // Signal names are case-insensitive and signals of base classes can be found as well
+        unsigned int count = 0;
+        const unsigned int id1 = button->connect("pressed", [&]{ count++; });
+        const unsigned int id2 = button->connect("MOUSERELEASED", [&]{ count++; });
+        const unsigned int id3 = button->connect("sizeChanged", [&]{ count++; });
+        REQUIRE_THROWS_AS(button->connect("Press", [&]{ count++; }), tgui::Exception);
+
+        button->onPress.emit(button.get(), "");
+        button->setSize(100, 25);
+        REQUIRE(count == 2);
+
+        // Connections can be removed in any order
+        REQUIRE(button->disconnect(id2));
+        REQUIRE(button->disconnect(id1));
+        REQUIRE(!button->disconnect(id1));
+        REQUIRE(button->disconnect(id3));
+    }
+
+    SECTION("Moved widget")
+    {
+        // The connections refer to the signals of the widget that they were moved to
+        tgui::Button button;
+        unsigned int count = 0;
+        const unsigned int id1 = button.connect("Pressed", [&]{ count++; });
+        const unsigned int id2 = button.connect(button.onPress, [&]{ count++; });
+
+        tgui::Button movedButton{std::move(button)};
+        movedButton.onPress.emit(&movedButton, "");
+        REQUIRE(count == 2);
+
+        REQUIRE(movedButton.disconnect(id1));
+        movedButton.onPress.emit(&movedButton, "");
+        REQUIRE(count == 3);
+
+        movedButton.disconnectAll();
+        movedButton.onPress.emit(&movedButton, "");
+        REQUIRE(count == 3);
+        REQUIRE(!movedButton.disconnect(id2));
+    }
 }
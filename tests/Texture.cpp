@@ -84,6 +84,43 @@ TEST_CASE("[Texture]")
                 REQUIRE(texture.getMiddleRect() == sf::IntRect(6, 5, 28, 20));
                 REQUIRE(texture.isSmooth() == false);
             }
+
+            SECTION("loadAsync")
+            {
+                auto image = tgui::Texture::loadAsync("resources/image.png");
+                REQUIRE(image.get() != nullptr);
+                REQUIRE(image.get()->getSize() == sf::Vector2u(50, 50));
+
+                // Loading the same image again reuses the image that is already loaded
+                REQUIRE(tgui::Texture::loadAsync("resources/image.png").get() == image.get());
+
+                tgui::Texture texture{"resources/image.png", {10, 5, 40, 30}};
+                REQUIRE(texture.getData()->image != nullptr);
+                REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(40, 30));
+
+                std::streambuf *oldbuf = sf::err().rdbuf(0);
+                auto images = tgui::Texture::loadAsync(std::vector<sf::String>{"resources/Texture1.png", "NonExistent.png"});
+                images.wait();
+                REQUIRE(tgui::Texture::loadAsync("NonExistent.png").get() == nullptr);
+                REQUIRE_THROWS_AS(tgui::Texture("NonExistent.png"), tgui::Exception);
+                sf::err().rdbuf(oldbuf);
+
+                REQUIRE(tgui::Texture("resources/Texture1.png").getData() != nullptr);
+
+                // Images that were already loaded, duplicates and an empty list complete the future without waiting for a task
+                auto loadedImages = tgui::Texture::loadAsync(std::vector<sf::String>{"resources/image.png", "resources/image.png"});
+                REQUIRE(loadedImages.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+                auto noImages = tgui::Texture::loadAsync(std::vector<sf::String>{});
+                REQUIRE(noImages.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+                // Images from which no texture was created can be released, images used by textures are kept
+                auto image2 = tgui::Texture::loadAsync("resources/Texture2.png");
+                REQUIRE(image2.get() != nullptr);
+                tgui::Texture::releaseAsync({"resources/Texture2.png", "resources/image.png"});
+                REQUIRE(tgui::Texture::loadAsync("resources/Texture2.png").get() != image2.get());
+                REQUIRE(tgui::Texture::loadAsync("resources/image.png").get() == image.get());
+                tgui::TextureManager::releaseAsyncImages();
+            }
         }
     }
 
@@ -289,6 +289,31 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getProperty("NonexistentProperty").getString() == "Text");
         }
 
+        SECTION("Property ids")
+        {
+            REQUIRE(tgui::getPropertyId("opacity") == tgui::PropertyId::Opacity);
+            REQUIRE(tgui::getPropertyName(tgui::PropertyId::TextureBackground) == "texturebackground");
+
+            // Unknown names get an id of their own, which stays the same when asking for it again
+            const tgui::PropertyId customId = tgui::getPropertyId("nonexistentproperty");
+            REQUIRE(customId >= tgui::PropertyId::BuiltinCount);
+            REQUIRE(tgui::getPropertyId("nonexistentproperty") == customId);
+            REQUIRE(tgui::getPropertyName(customId) == "nonexistentproperty");
+
+            renderer->setOpacity(0.5f);
+            REQUIRE(renderer->getProperty(tgui::PropertyId::Opacity).getNumber() == 0.5f);
+            REQUIRE(renderer->getProperty("Opacity").getNumber() == 0.5f);
+
+            // Looking up a name doesn't give it an id
+            tgui::PropertyId unusedId;
+            REQUIRE(!tgui::tryGetPropertyId("neverusedproperty", unusedId));
+            REQUIRE(renderer->getProperty("NeverUsedProperty").getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(renderer->getData()->propertyValuePairs.count("neverusedproperty") == 0);
+            REQUIRE(!tgui::tryGetPropertyId("neverusedproperty", unusedId));
+            REQUIRE(tgui::tryGetPropertyId("opacity", unusedId));
+            REQUIRE(unusedId == tgui::PropertyId::Opacity);
+        }
+
         SECTION("Clone")
         {
             renderer->setOpacity(0.5f);
@@ -300,6 +325,151 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Copy-on-write")
+        {
+            auto editBox1 = tgui::EditBox::create();
+            auto editBox2 = tgui::EditBox::create();
+            auto editBox3 = tgui::EditBox::create();
+            const sf::Color themeBorderColor = editBox1->getSharedRenderer()->getBorderColor();
+            const sf::Color themeBackgroundColor = editBox1->getSharedRenderer()->getBackgroundColor();
+
+            editBox1->getRenderer()->setTextColor(sf::Color::Red);
+            editBox2->getRenderer()->setTextColor(sf::Color::Green);
+            editBox3->getRenderer()->setBackgroundColor(themeBackgroundColor);
+
+            // Only the changed properties are stored, the others are shared between the renderers
+            auto data1 = editBox1->getSharedRenderer()->getData();
+            auto data2 = editBox2->getSharedRenderer()->getData();
+            auto data3 = editBox3->getSharedRenderer()->getData();
+            REQUIRE(data1->propertyValuePairs.size() == 1);
+            REQUIRE(data2->propertyValuePairs.size() == 1);
+            REQUIRE(data3->propertyValuePairs.empty());
+            REQUIRE(data1->base != nullptr);
+            REQUIRE(data1->base == data2->base);
+            REQUIRE(data1->base == data3->base);
+
+            REQUIRE(editBox1->getSharedRenderer()->getTextColor() == sf::Color::Red);
+            REQUIRE(editBox2->getSharedRenderer()->getTextColor() == sf::Color::Green);
+            REQUIRE(editBox1->getSharedRenderer()->getBorderColor() == themeBorderColor);
+            REQUIRE(editBox3->getSharedRenderer()->getBackgroundColor() == themeBackgroundColor);
+
+            // Accessing all properties at once doesn't copy the shared properties into the renderer
+            auto pairs = editBox1->getSharedRenderer()->getPropertyValuePairs();
+            REQUIRE(pairs["textcolor"].getColor() == sf::Color::Red);
+            REQUIRE(pairs["bordercolor"].getColor() == themeBorderColor);
+            REQUIRE(data1->propertyValuePairs.size() == 1);
+            REQUIRE(data1->base == data2->base);
+
+            // Giving a widget a different renderer doesn't copy the shared properties into either renderer
+            editBox2->setRenderer(data1);
+            REQUIRE(editBox2->getSharedRenderer()->getTextColor() == sf::Color::Red);
+            REQUIRE(data1->propertyValuePairs.size() == 1);
+            REQUIRE(data2->propertyValuePairs.size() == 1);
+            REQUIRE(data1->base == data2->base);
+
+            // Values in the shared base are never converted or copied when they are read
+            auto baseProperties = std::make_shared<tgui::PropertyTable>();
+            (*baseProperties)["textcolor"] = tgui::ObjectConverter{"Blue"};
+            (*baseProperties)["bordercolor"] = tgui::ObjectConverter{sf::Color::Yellow};
+            (*baseProperties)["texture"] = tgui::ObjectConverter{tgui::Texture{"resources/image.png"}};
+            auto data4 = tgui::RendererData::create();
+            data4->base = baseProperties;
+            tgui::EditBoxRenderer renderer4;
+            renderer4.setData(data4);
+            REQUIRE(renderer4.getTextColor() == sf::Color::Blue);
+            REQUIRE(renderer4.getBorderColor() == sf::Color::Yellow);
+            REQUIRE(&renderer4.getTexture() == &data4->base->at("texture").getTexture());
+            REQUIRE(data4->base->at("textcolor").getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(data4->propertyValuePairs.empty());
+
+            // Properties that are only stored in the base are still serialized
+            const std::string serialized = tgui::Serializer::serialize(tgui::ObjectConverter{data4});
+            REQUIRE(serialized.find("bordercolor") != std::string::npos);
+            REQUIRE(data4->base != nullptr);
+        }
+
+        SECTION("Geometry update")
+        {
+            struct GeometryWidget : public tgui::ClickableWidget
+            {
+                void rendererChanged(tgui::PropertyId property) override
+                {
+                    if ((property == tgui::PropertyId::BordersProperty) || (property == tgui::PropertyId::PaddingProperty))
+                        requestGeometryUpdate();
+                    else
+                        tgui::ClickableWidget::rendererChanged(property);
+                }
+
+                void updateGeometry() override
+                {
+                    geometryUpdates++;
+                }
+
+                unsigned int geometryUpdates = 0;
+            };
+
+            auto geometryWidget = std::make_shared<GeometryWidget>();
+            geometryWidget->getRenderer()->setProperty("Borders", tgui::Borders{1});
+            REQUIRE(geometryWidget->geometryUpdates == 1);
+            geometryWidget->getRenderer()->setProperty("Padding", tgui::Padding{1});
+            REQUIRE(geometryWidget->geometryUpdates == 2);
+
+            // Changing the whole renderer only updates the geometry once
+            geometryWidget->setRenderer(tgui::RendererData::create({{"borders", tgui::Borders{2}}, {"padding", tgui::Padding{3}}, {"opacity", 0.5f}}));
+            REQUIRE(geometryWidget->geometryUpdates == 3);
+
+            // The postponed update is discarded when applying the renderer fails
+            REQUIRE_THROWS_AS(geometryWidget->setRenderer(tgui::RendererData::create({{"borders", tgui::Borders{4}}, {"nonexistentproperty", "Text"}})), tgui::Exception);
+            REQUIRE(geometryWidget->geometryUpdates == 3);
+            geometryWidget->getRenderer()->setProperty("Borders", tgui::Borders{5});
+            REQUIRE(geometryWidget->geometryUpdates == 4);
+
+            // Properties that are changed together only update the geometry once
+            geometryWidget->getRenderer()->setProperties({{"Borders", tgui::Borders{6}}, {"Padding", tgui::Padding{7}}});
+            REQUIRE(geometryWidget->geometryUpdates == 5);
+        }
+
+        SECTION("Batched updates")
+        {
+            auto renderer = widget->getRenderer();
+
+            std::vector<std::vector<tgui::PropertyId>> batches;
+            unsigned int propertyChanges = 0;
+            renderer->subscribeBatched(&batches, [&](const std::vector<tgui::PropertyId>& properties){ batches.push_back(properties); });
+            renderer->subscribe(&propertyChanges, [&](tgui::PropertyId){ propertyChanges++; });
+
+            renderer->setOpacity(0.5f);
+            REQUIRE(batches.size() == 1);
+            REQUIRE(batches[0] == std::vector<tgui::PropertyId>{tgui::PropertyId::Opacity});
+            REQUIRE(propertyChanges == 1);
+
+            renderer->beginUpdate();
+            renderer->setOpacity(0.8f);
+            renderer->beginUpdate();
+            renderer->setTransparentTexture(true);
+            renderer->setOpacity(0.6f);
+            renderer->endUpdate();
+            REQUIRE(batches.size() == 1);
+            REQUIRE(propertyChanges == 1);
+            renderer->endUpdate();
+            REQUIRE(batches.size() == 2);
+            REQUIRE(batches[1] == std::vector<tgui::PropertyId>{tgui::PropertyId::Opacity, tgui::PropertyId::TransparentTexture});
+            REQUIRE(propertyChanges == 3);
+            REQUIRE(widget->getRenderer()->getOpacity() == 0.6f);
+
+            // Setting properties to their current value doesn't inform the subscribers
+            renderer->setProperties({{"Opacity", 0.6f}, {"TransparentTexture", false}});
+            REQUIRE(batches.size() == 3);
+            REQUIRE(batches[2] == std::vector<tgui::PropertyId>{tgui::PropertyId::TransparentTexture});
+            REQUIRE(propertyChanges == 4);
+
+            renderer->unsubscribe(&batches);
+            renderer->unsubscribe(&propertyChanges);
+            renderer->setOpacity(1);
+            REQUIRE(batches.size() == 3);
+            REQUIRE(propertyChanges == 4);
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
@@ -0,0 +1,179 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/AnchorLayout.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+using Edge = tgui::AnchorLayout::Edge;
+
+TEST_CASE("[AnchorLayout]")
+{
+    auto layout = tgui::AnchorLayout::create({400, 300});
+
+    auto widget1 = tgui::ClickableWidget::create({50, 20});
+    auto widget2 = tgui::ClickableWidget::create({50, 20});
+    auto widget3 = tgui::ClickableWidget::create({50, 20});
+    layout->add(widget1, "W1");
+    layout->add(widget2, "W2");
+    layout->add(widget3, "W3");
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(layout->getWidgetType() == "AnchorLayout");
+    }
+
+    SECTION("Anchors")
+    {
+        REQUIRE(!layout->isAnchored(widget1, Edge::Right));
+
+        layout->setAnchor(widget1, Edge::Right, Edge::Right, 10);
+        layout->setAnchor(widget1, Edge::Bottom, Edge::Bottom, 10);
+        REQUIRE(layout->isAnchored(widget1, Edge::Right));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(340, 270));
+
+        layout->setAnchor(widget2, Edge::Right, widget1, Edge::Left, 10);
+        layout->setAnchor(widget2, Edge::Top, widget1, Edge::Top);
+        REQUIRE(widget2->getPosition() == sf::Vector2f(280, 270));
+
+        layout->setAnchor(widget3, Edge::Left, Edge::Left, 10);
+        layout->setAnchor(widget3, Edge::Right, Edge::Right, 10);
+        layout->setAnchor(widget3, Edge::Top, Edge::Top, 5);
+        REQUIRE(widget3->getPosition() == sf::Vector2f(10, 5));
+        REQUIRE(widget3->getSize() == sf::Vector2f(380, 20));
+
+        layout->setSize(200, 100);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(140, 70));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(80, 70));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(10, 5));
+        REQUIRE(widget3->getSize() == sf::Vector2f(180, 20));
+
+        // Widgets that depend on a resized widget are moved as well
+        widget1->setSize(60, 20);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(130, 70));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(70, 70));
+
+        layout->getRenderer()->setPadding({10});
+        REQUIRE(widget1->getPosition() == sf::Vector2f(110, 50));
+        REQUIRE(widget3->getSize() == sf::Vector2f(160, 20));
+
+        layout->removeAnchor(widget3, Edge::Right);
+        REQUIRE(!layout->isAnchored(widget3, Edge::Right));
+        layout->setSize(300, 100);
+        REQUIRE(widget3->getSize() == sf::Vector2f(160, 20));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(10, 5));
+
+        // Removing a widget removes the anchors to it
+        layout->remove(widget1);
+        REQUIRE(!layout->isAnchored(widget2, Edge::Right));
+        layout->setSize(200, 100);
+        REQUIRE(widget2->getPosition() == sf::Vector2f(150, 50));
+    }
+
+    SECTION("Center")
+    {
+        widget1->setSize(40, 40);
+        layout->setAnchor(widget1, Edge::HorizontalCenter, Edge::HorizontalCenter);
+        layout->setAnchor(widget1, Edge::VerticalCenter, Edge::VerticalCenter, -10);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(180, 120));
+
+        layout->setAnchor(widget2, Edge::Left, widget1, Edge::HorizontalCenter);
+        layout->setAnchor(widget2, Edge::HorizontalCenter, Edge::Right);
+        REQUIRE(widget2->getPosition() == sf::Vector2f(200, 0));
+        REQUIRE(widget2->getSize() == sf::Vector2f(400, 20));
+    }
+
+    SECTION("Size constraints")
+    {
+        REQUIRE(layout->getMinimumSize(widget1) == sf::Vector2f(0, 0));
+        REQUIRE(layout->getAspectRatio(widget1) == 0);
+
+        layout->setAnchor(widget1, Edge::Left, Edge::Left);
+        layout->setAnchor(widget1, Edge::Right, Edge::Right);
+        layout->setMaximumSize(widget1, {150, 100});
+        REQUIRE(layout->getMaximumSize(widget1) == sf::Vector2f(150, 100));
+        REQUIRE(widget1->getSize() == sf::Vector2f(150, 20));
+
+        layout->setMinimumSize(widget1, {50, 30});
+        REQUIRE(layout->getMinimumSize(widget1) == sf::Vector2f(50, 30));
+        REQUIRE(widget1->getSize() == sf::Vector2f(150, 30));
+
+        layout->setSize(40, 300);
+        REQUIRE(widget1->getSize() == sf::Vector2f(50, 30));
+
+        layout->setAspectRatio(widget2, 2);
+        REQUIRE(layout->getAspectRatio(widget2) == 2);
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 25));
+
+        layout->setAnchor(widget2, Edge::Top, Edge::Top);
+        layout->setAnchor(widget2, Edge::Bottom, Edge::Bottom);
+        REQUIRE(widget2->getSize() == sf::Vector2f(600, 300));
+
+        layout->setAnchor(widget2, Edge::Left, Edge::Left);
+        layout->setAnchor(widget2, Edge::Right, Edge::Right);
+        REQUIRE(widget2->getSize() == sf::Vector2f(40, 20));
+    }
+
+    SECTION("Invalid anchors")
+    {
+        auto widget4 = tgui::ClickableWidget::create();
+        REQUIRE_THROWS_AS(layout->setAnchor(widget4, Edge::Left, Edge::Left), tgui::Exception);
+        REQUIRE_THROWS_AS(layout->setAnchor(widget1, Edge::Left, widget4, Edge::Left), tgui::Exception);
+        REQUIRE_THROWS_AS(layout->setAnchor(widget1, Edge::Left, widget1, Edge::Right), tgui::Exception);
+        REQUIRE_THROWS_AS(layout->setAnchor(widget1, Edge::Left, Edge::Top), tgui::Exception);
+
+        layout->setAnchor(widget1, Edge::Left, widget2, Edge::Right);
+        layout->setAnchor(widget2, Edge::Left, widget3, Edge::Right);
+        REQUIRE_THROWS_AS(layout->setAnchor(widget3, Edge::Top, widget1, Edge::Bottom), tgui::Exception);
+        REQUIRE(!layout->isAnchored(widget3, Edge::Top));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(100, 0));
+    }
+
+    SECTION("Copying")
+    {
+        layout->setAnchor(widget1, Edge::Right, Edge::Right);
+        layout->setAnchor(widget2, Edge::Right, widget1, Edge::Left);
+
+        auto layoutCopy = tgui::AnchorLayout::copy(layout);
+        layoutCopy->setSize(200, 100);
+        REQUIRE(layoutCopy->get("W1")->getPosition() == sf::Vector2f(150, 0));
+        REQUIRE(layoutCopy->get("W2")->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(350, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(300, 0));
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        layout->setAnchor(widget1, Edge::Right, Edge::Right, 10);
+        layout->setAnchor(widget1, Edge::Bottom, Edge::Bottom, 10);
+        layout->setAnchor(widget2, Edge::Right, widget1, Edge::Left, 10);
+        layout->setAnchor(widget3, Edge::HorizontalCenter, Edge::HorizontalCenter);
+        layout->setMinimumSize(widget3, {10, 15});
+        layout->setMaximumSize(widget2, {100, 80});
+        layout->setAspectRatio(widget1, 2.5f);
+
+        testSavingWidget("AnchorLayout", layout, false);
+    }
+}
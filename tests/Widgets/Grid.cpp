@@ -108,6 +108,65 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidgetAlignment(0, 0) == tgui::Grid::Alignment::Center);
     }
 
+    SECTION("Span")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({250, 30});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 1, 0);
+
+        REQUIRE(grid->getWidgetSpan(widget3) == std::make_pair<std::size_t, std::size_t>(1, 1));
+        REQUIRE(grid->getWidget(1, 1) == nullptr);
+
+        grid->setWidgetSpan(widget3, 1, 2);
+        REQUIRE(grid->getWidgetSpan(1, 0) == std::make_pair<std::size_t, std::size_t>(1, 2));
+        REQUIRE(grid->getWidget(1, 1) == widget3);
+        REQUIRE(grid->getRowCount() == 2);
+        REQUIRE(grid->getColumnCount() == 2);
+
+        // The missing width is divided over both columns
+        REQUIRE(grid->getSize() == sf::Vector2f(250, 80));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(32.5f, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(197.5f, 20));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(0, 50));
+
+        // You can't change the span of an empty cell
+        grid->setWidgetSpan(1, 1, 3, 3);
+        REQUIRE(grid->getWidgetSpan(1, 1) == std::make_pair<std::size_t, std::size_t>(1, 1));
+    }
+
+    SECTION("Widget size changes")
+    {
+        auto widget1 = tgui::ClickableWidget::create({40, 30});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({10, 10});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 1, 0);
+
+        REQUIRE(grid->getSize() == sf::Vector2f(60, 40));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(40, 10));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(15, 30));
+
+        widget3->setSize({60, 10});
+        REQUIRE(grid->getSize() == sf::Vector2f(80, 40));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(10, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(60, 10));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(0, 30));
+
+        widget3->setSize({10, 10});
+        REQUIRE(grid->getSize() == sf::Vector2f(60, 40));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(40, 10));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(15, 30));
+
+        grid->remove(widget3);
+        REQUIRE(grid->getSize() == sf::Vector2f(60, 30));
+        REQUIRE(grid->getRowCount() == 1);
+    }
+
     SECTION("Saving and loading from file")
     {
         grid->setSize({800, 600});
@@ -123,6 +182,7 @@ TEST_CASE("[Grid]")
         grid->addWidget(tgui::ClickableWidget::create({40, 30}), 2, 1, {}, tgui::Grid::Alignment::Bottom);
         grid->addWidget(tgui::ClickableWidget::create({40, 30}), 2, 2, {}, tgui::Grid::Alignment::BottomLeft);
         grid->add(tgui::ClickableWidget::create({40, 30}));
+        grid->setWidgetSpan(5, 4, 2, 3);
 
         testSavingWidget("Grid", grid, false);
     }